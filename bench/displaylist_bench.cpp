@@ -0,0 +1,92 @@
+/*
+   Host check and benchmark for display list diffing.
+
+   Build and run from the repository root:
+     g++ -O2 -std=c++17 -Isrc bench/displaylist_bench.cpp src/displaylist.cpp -o displaylist_bench
+     ./displaylist_bench
+
+   The same frame is recorded twice with the stack dirtied differently before
+   each recording; payload padding must not leak into the arena, so the diff
+   has to come back empty. A one-command change must give exactly its rect.
+*/
+
+#include "displaylist.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+static const size_t ARENA = 8192;
+static const int MAX_RECTS = 8;
+
+// Fill a chunk of stack below the caller with a pattern, then return
+__attribute__((noinline)) static void dirtyStack(uint8_t pattern) {
+    volatile uint8_t junk[4096];
+    for (size_t i = 0; i < sizeof(junk); i++) junk[i] = (uint8_t)(pattern + i);
+}
+
+__attribute__((noinline)) static void recordFrame(DisplayList &list, int temperature) {
+    static const int16_t arrow[4][2] = { { 0, -20 }, { 8, 10 }, { 0, 4 }, { -8, 10 } };
+    static const int16_t line[5][2] = { { 10, 400 }, { 50, 380 }, { 90, 390 }, { 130, 360 }, { 170, 370 } };
+    static const int font = 0;
+    char text[16];
+
+    list.clear();
+    list.setPanel(1);
+    list.setTextColor(0x0000, 0xFFFF);
+    list.setTextSize(2);
+    list.setTextDatum(0);
+    snprintf(text, sizeof(text), "%d C", temperature);
+    list.drawString(text, 40, 60);
+    list.drawLine(0, 100, 300, 100, 0x0000);
+    list.drawRect(10, 10, 200, 120, 0x0000);
+    list.fillRect(220, 10, 40, 40, 0x8410);
+    list.drawCircle(400, 80, 30, 0x0000);
+    list.fillCircle(400, 80, 4, 0x0000);
+    list.fillTriangle(500, 20, 520, 60, 480, 60, 0x0000);
+    list.drawPixel(600, 50, 0x0000);
+
+    list.setPanel(2);
+    list.drawIcon(700, 20, IMAGE_01D, ICON_GRAY4);
+    list.drawGlyphs(&font, "21", 800, 20, DrawBounds{ 800, 20, 40, 30 });
+    list.drawArc(400, 300, 16, 225, 315, 0x0000);
+    list.fillPolygon(arrow, 4, 0x0000);
+    list.drawPolyline(line, 5, 4, 0x0000);
+}
+
+int main() {
+    static uint8_t arenaA[ARENA], arenaB[ARENA];
+    DisplayList before(arenaA, ARENA), after(arenaB, ARENA);
+    DrawBounds rects[MAX_RECTS];
+
+    dirtyStack(0x11);
+    recordFrame(before, 21);
+    dirtyStack(0xA7);
+    recordFrame(after, 21);
+
+    int same = diffDisplayLists(before, after, rects, MAX_RECTS);
+    printf("identical frames   %d changed rects  %s\n", same, same == 0 ? "ok" : "FAIL");
+    if (same != 0) {
+        for (int i = 0; i < same; i++) printf("  %d,%d %dx%d\n", rects[i].x, rects[i].y, rects[i].w, rects[i].h);
+        return 1;
+    }
+    if (before.size() != after.size() || memcmp(before.data(), after.data(), before.size()) != 0) {
+        printf("arenas differ byte for byte  FAIL\n");
+        return 1;
+    }
+
+    dirtyStack(0x3C);
+    recordFrame(after, 22);
+    int changed = diffDisplayLists(before, after, rects, MAX_RECTS);
+    bool ok = changed == 1 && rects[0].x == 40 && rects[0].y == 60;
+    printf("one text changed   %d changed rects  %s\n", changed, ok ? "ok" : "FAIL");
+    if (!ok) return 1;
+
+    const int iterations = 100000;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) diffDisplayLists(before, after, rects, MAX_RECTS);
+    auto t1 = std::chrono::steady_clock::now();
+    printf("diff %u bytes: %.3f us\n", (unsigned)after.size(),
+           std::chrono::duration<double, std::micro>(t1 - t0).count() / iterations);
+    return 0;
+}
@@ -0,0 +1,122 @@
+/*
+   Host benchmark for the LTTB graph downsampler.
+
+   Build and run from the repository root:
+     g++ -O2 -std=c++17 -Isrc bench/downsample_bench.cpp src/downsample.cpp -o downsample_bench
+     ./downsample_bench
+
+   Every case is checked against a straightforward floating-point LTTB; the
+   timings are per call, which the graph row makes once per line series and
+   render.
+*/
+
+#include "downsample.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+static uint32_t rngState = 12345;
+static uint32_t nextRandom() {
+    rngState = rngState * 1664525u + 1013904223u;
+    return rngState >> 8;
+}
+
+// Textbook LTTB with double-precision centroids
+static std::vector<uint16_t> referenceLttb(const std::vector<int16_t> &v, int target) {
+    int count = v.size();
+    std::vector<uint16_t> out;
+    if (target >= count) {
+        for (int i = 0; i < count; i++) out.push_back(i);
+        return out;
+    }
+    double every = (double)(count - 2) / (target - 2);
+    int a = 0;
+    out.push_back(0);
+    for (int b = 0; b < target - 2; b++) {
+        int start = 1 + (int)std::floor(b * every);
+        int end = 1 + (int)std::floor((b + 1) * every);
+        int nextStart = b + 1 < target - 2 ? end : count - 1;
+        int nextEnd = b + 1 < target - 2 ? 1 + (int)std::floor((b + 2) * every) : count;
+        double cx = 0, cy = 0;
+        for (int i = nextStart; i < nextEnd; i++) {
+            cx += i;
+            cy += v[i];
+        }
+        cx /= nextEnd - nextStart;
+        cy /= nextEnd - nextStart;
+        double best = -1;
+        int bestIndex = start;
+        for (int i = start; i < end; i++) {
+            double area = std::fabs((a - cx) * (v[i] - v[a]) - (a - i) * (cy - v[a]));
+            if (area > best) {
+                best = area;
+                bestIndex = i;
+            }
+        }
+        out.push_back(bestIndex);
+        a = bestIndex;
+    }
+    out.push_back(count - 1);
+    return out;
+}
+
+// A diurnal temperature curve in tenths with some noise
+static std::vector<int16_t> makeTemperature(int count) {
+    std::vector<int16_t> v(count);
+    for (int i = 0; i < count; i++) {
+        v[i] = (int16_t)(150 + 60 * std::sin((i - 9) * 2 * M_PI / 24) + (int)(nextRandom() % 11) - 5);
+    }
+    return v;
+}
+
+// Mostly dry with short spikes, like precipitation chance
+static std::vector<int16_t> makeSpiky(int count) {
+    std::vector<int16_t> v(count);
+    for (int i = 0; i < count; i++) {
+        v[i] = nextRandom() % 8 == 0 ? (int16_t)(nextRandom() % 100) : 0;
+    }
+    return v;
+}
+
+static void runCase(const char *name, const std::vector<int16_t> &values, int target) {
+    std::vector<uint16_t> indices(values.size());
+    const int iterations = 100000;
+
+    int picked = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        picked = lttbSelect(values.data(), values.size(), target, indices.data());
+    }
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::vector<uint16_t> expected = referenceLttb(values, target);
+    bool ok = picked == (int)expected.size();
+    for (int i = 0; ok && i < picked; i++) ok = indices[i] == expected[i];
+
+    // The spikes worth keeping: how much of the series' range survives
+    int lo = values[0], hi = values[0], keptLo = values[0], keptHi = values[0];
+    for (int16_t v : values) {
+        lo = std::min(lo, (int)v);
+        hi = std::max(hi, (int)v);
+    }
+    for (int i = 0; i < picked; i++) {
+        keptLo = std::min(keptLo, (int)values[indices[i]]);
+        keptHi = std::max(keptHi, (int)values[indices[i]]);
+    }
+
+    double us = std::chrono::duration<double, std::micro>(t1 - t0).count() / iterations;
+    printf("%-12s %4zu -> %3d points  range kept %5d..%-5d of %5d..%-5d  %7.3f us  %s\n",
+           name, values.size(), picked, keptLo, keptHi, lo, hi, us, ok ? "matches reference" : "MISMATCH");
+    if (!ok) exit(1);
+}
+
+int main() {
+    runCase("temp 24h", makeTemperature(24), 24);
+    runCase("temp 48h", makeTemperature(48), 24);
+    runCase("precip 48h", makeSpiky(48), 24);
+    runCase("temp 168h", makeTemperature(168), 24);
+    runCase("precip 168h", makeSpiky(168), 48);
+    return 0;
+}
@@ -0,0 +1,26 @@
+/*
+   Host stand-in for esp-dsp's dsps_add.h, for bench/series_kernels_bench.cpp
+   only: the s16 kernel with the arithmetic of esp-dsp's reference (ansi)
+   implementation, so the host can run the device code path.
+*/
+
+#ifndef BENCH_DSPS_ADD_H
+#define BENCH_DSPS_ADD_H
+
+#include <stdint.h>
+
+#ifndef ESP_OK
+typedef int esp_err_t;
+#define ESP_OK 0
+#endif
+
+inline esp_err_t dsps_add_s16(const int16_t *input1, const int16_t *input2, int16_t *output, int len,
+                              int step1, int step2, int step_out, int shift) {
+    for (int i = 0; i < len; i++) {
+        int32_t acc = (int32_t)input1[i * step1] + (int32_t)input2[i * step2];
+        output[i * step_out] = (int16_t)(acc >> shift);
+    }
+    return ESP_OK;
+}
+
+#endif // BENCH_DSPS_ADD_H
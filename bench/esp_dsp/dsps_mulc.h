@@ -0,0 +1,26 @@
+/*
+   Host stand-in for esp-dsp's dsps_mulc.h, for bench/series_kernels_bench.cpp
+   only: the s16 kernel with the arithmetic of esp-dsp's reference (ansi)
+   implementation, so the host can run the device code path.
+*/
+
+#ifndef BENCH_DSPS_MULC_H
+#define BENCH_DSPS_MULC_H
+
+#include <stdint.h>
+
+#ifndef ESP_OK
+typedef int esp_err_t;
+#define ESP_OK 0
+#endif
+
+inline esp_err_t dsps_mulc_s16(const int16_t *input, int16_t *output, int len, int16_t C,
+                               int step_in, int step_out) {
+    for (int i = 0; i < len; i++) {
+        int32_t acc = (int32_t)input[i * step_in] * (int32_t)C;
+        output[i * step_out] = (int16_t)(acc >> 15);
+    }
+    return ESP_OK;
+}
+
+#endif // BENCH_DSPS_MULC_H
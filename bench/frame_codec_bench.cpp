@@ -0,0 +1,114 @@
+/*
+   Host benchmark for the row-RLE frame codec used by the framebuffer snapshot.
+
+   Build and run from the repository root:
+     g++ -O2 -std=c++17 -Isrc bench/frame_codec_bench.cpp src/frame_codec.cpp -o frame_codec_bench
+     ./frame_codec_bench
+
+   Frames are 960x540 packed 4bpp (two pixels per byte, 15 = white), the same
+   layout as the dashboard canvas.
+*/
+
+#include "frame_codec.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+static const int WIDTH = 960;
+static const int HEIGHT = 540;
+static const size_t ROW_BYTES = WIDTH / 2;
+
+static uint32_t rngState = 12345;
+static uint32_t nextRandom() {
+    rngState = rngState * 1664525u + 1013904223u;
+    return rngState >> 8;
+}
+
+static void setPixel(std::vector<uint8_t> &frame, int x, int y, uint8_t gray) {
+    if (x < 0 || y < 0 || x >= WIDTH || y >= HEIGHT) return;
+    uint8_t &b = frame[y * ROW_BYTES + x / 2];
+    b = (x & 1) ? (b & 0xF0) | gray : (b & 0x0F) | (gray << 4);
+}
+
+static void hLine(std::vector<uint8_t> &f, int x, int y, int w) { for (int i = 0; i < w; i++) setPixel(f, x + i, y, 0); }
+static void vLine(std::vector<uint8_t> &f, int x, int y, int h) { for (int i = 0; i < h; i++) setPixel(f, x, y + i, 0); }
+
+// Roughly what displayWeather() produces: panel borders, text, icons and graphs
+static std::vector<uint8_t> makeDashboardFrame() {
+    std::vector<uint8_t> f(ROW_BYTES * HEIGHT, 0xFF);
+
+    hLine(f, 14, 34, 932); hLine(f, 14, 530, 932); vLine(f, 14, 34, 497); vLine(f, 945, 34, 497);
+    hLine(f, 15, 286, 930); hLine(f, 15, 408, 930);
+    for (int x : {232, 465, 697}) vLine(f, x, 35, 251);
+    for (int i = 1; i < 8; i++) vLine(f, 15 + i * 116, 286, 122);
+
+    // Text: random 12x16 glyph blocks with ~40% ink
+    for (int n = 0; n < 260; n++) {
+        int x = nextRandom() % (WIDTH - 12);
+        int y = nextRandom() % (HEIGHT - 16);
+        for (int yy = 0; yy < 16; yy++)
+            for (int xx = 0; xx < 12; xx++)
+                if (nextRandom() % 10 < 4) setPixel(f, x + xx, y + yy, 0);
+    }
+
+    // Grayscale icons: 64x64 shaded discs
+    for (int n = 0; n < 14; n++) {
+        int cx = 40 + (nextRandom() % (WIDTH - 80));
+        int cy = 40 + (nextRandom() % (HEIGHT - 80));
+        for (int yy = -32; yy < 32; yy++)
+            for (int xx = -32; xx < 32; xx++)
+                if (xx * xx + yy * yy < 28 * 28) setPixel(f, cx + xx, cy + yy, (uint8_t)((xx + yy + 64) / 10 % 16));
+    }
+
+    // Graph polylines
+    for (int g = 0; g < 4; g++) {
+        int y = 470;
+        for (int x = 0; x < 200; x++) {
+            y += (int)(nextRandom() % 5) - 2;
+            setPixel(f, 40 + g * 232 + x, y, 0);
+        }
+    }
+    return f;
+}
+
+static std::vector<uint8_t> makeNoiseFrame() {
+    std::vector<uint8_t> f(ROW_BYTES * HEIGHT);
+    for (auto &b : f) b = (uint8_t)nextRandom();
+    return f;
+}
+
+static void runCase(const char *name, const std::vector<uint8_t> &frame) {
+    std::vector<uint8_t> encoded(rleMaxRowSize(ROW_BYTES) * HEIGHT);
+    std::vector<uint8_t> decoded(frame.size());
+    const int iterations = 50;
+
+    size_t encodedSize = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        encodedSize = rleEncodeFrame(frame.data(), ROW_BYTES, HEIGHT, encoded.data(), encoded.size());
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    bool ok = true;
+    for (int i = 0; i < iterations; i++) {
+        ok &= rleDecodeFrame(encoded.data(), encodedSize, decoded.data(), ROW_BYTES, HEIGHT);
+    }
+    auto t2 = std::chrono::steady_clock::now();
+
+    ok &= memcmp(frame.data(), decoded.data(), frame.size()) == 0;
+    double encUs = std::chrono::duration<double, std::micro>(t1 - t0).count() / iterations;
+    double decUs = std::chrono::duration<double, std::micro>(t2 - t1).count() / iterations;
+
+    printf("%-10s %7zu -> %7zu bytes  ratio %6.1f:1  encode %8.1f us  decode %8.1f us  %s\n",
+           name, frame.size(), encodedSize, (double)frame.size() / encodedSize, encUs, decUs,
+           ok ? "round-trip OK" : "ROUND-TRIP FAILED");
+    if (!ok) exit(1);
+}
+
+int main() {
+    runCase("blank", std::vector<uint8_t>(ROW_BYTES * HEIGHT, 0xFF));
+    runCase("dashboard", makeDashboardFrame());
+    runCase("noise", makeNoiseFrame());
+    return 0;
+}
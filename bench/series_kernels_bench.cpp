@@ -0,0 +1,164 @@
+/*
+   Host benchmark for the series kernels.
+
+   Build and run from the repository root:
+     g++ -O2 -std=c++17 -Isrc bench/series_kernels_bench.cpp src/series_kernels.cpp -o series_kernels_bench
+     ./series_kernels_bench
+
+   The device path of seriesToPixels() (esp-dsp) runs on the host against
+   stand-ins with esp-dsp's reference arithmetic (bench/esp_dsp):
+     g++ -O2 -std=c++17 -Isrc -Ibench/esp_dsp -DSERIES_KERNELS_DSP=1 \
+         bench/series_kernels_bench.cpp src/series_kernels.cpp -o series_kernels_bench_dsp
+     ./series_kernels_bench_dsp
+   Both builds compare against the same per-point reference, so passing both
+   means the two paths give identical pixels.
+
+   Each kernel is compared with the per-point code it replaces (or a plain
+   reference); integer results must match bit for bit, the dew point within
+   one tenth of a double-precision reference.
+*/
+
+#include "series_kernels.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+static uint32_t rngState = 12345;
+static uint32_t nextRandom() {
+    rngState = rngState * 1664525u + 1013904223u;
+    return rngState >> 8;
+}
+
+static const int POINTS = 48;        // One hourly graph
+static const int ITERATIONS = 200000;
+
+static volatile int sink;            // Keeps the timed loops from being optimised away
+
+template <typename F>
+static double timeMicros(F &&fn) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++) fn();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(t1 - t0).count() / ITERATIONS;
+}
+
+static void report(const char *name, double before, double after, bool ok) {
+    printf("%-16s %8.3f us -> %8.3f us  %s\n", name, before, after, ok ? "identical" : "MISMATCH");
+    if (!ok) exit(1);
+}
+
+// The graph engine's y mapping: setRange()'s shift and Q15 scale for a
+// plot dy pixels high, and plotY() one call per point
+struct YScale {
+    int32_t lo, hi, shift, scaleQ15;
+};
+
+static YScale yScale(int32_t lo, int32_t hi, int32_t dy) {
+    YScale s = { lo, hi, 0, 0 };
+    while (((hi - lo) << s.shift) <= dy && ((hi - lo) << (s.shift + 1)) <= INT16_MAX) s.shift++;
+    s.scaleQ15 = (dy << 15) / ((hi - lo) << s.shift);
+    return s;
+}
+
+static int referencePlotY(int32_t v, const YScale &s, int32_t top) {
+    if (v < s.lo) v = s.lo;
+    if (v > s.hi) v = s.hi;
+    return top + ((((s.hi - v) << s.shift) * s.scaleQ15) >> 15);
+}
+
+int main() {
+    std::vector<int16_t> values(POINTS), humidity(POINTS);
+    for (int i = 0; i < POINTS; i++) {
+        values[i] = (int16_t)(150 + 60 * std::sin(i * 2 * M_PI / 24) + (int)(nextRandom() % 21) - 10);
+        humidity[i] = (int16_t)(30 + nextRandom() % 71);
+    }
+
+    // Min/max
+    {
+        int16_t lo = 0, hi = 0, refLo = 0, refHi = 0;
+        double before = timeMicros([&] {
+            int32_t l = INT16_MAX, h = INT16_MIN;
+            for (int i = 0; i < POINTS; i++) {
+                if (values[i] < l) l = values[i];
+                if (values[i] > h) h = values[i];
+            }
+            refLo = l;
+            refHi = h;
+            sink = l + h;
+        });
+        double after = timeMicros([&] {
+            seriesMinMax(values.data(), POINTS, lo, hi);
+            sink = lo + hi;
+        });
+        report("minmax", before, after, lo == refLo && hi == refHi);
+    }
+
+    // Scale to pixels: a clamped range, a range narrower than the plot (shifted),
+    // the fixed percent range and one far wider than the plot
+    printf("to pixels: %s path\n", SERIES_KERNELS_DSP ? "esp-dsp" : "portable");
+    {
+        static const int32_t ranges[][2] = { { 100, 200 }, { 140, 160 }, { 0, 100 }, { -2000, 3000 } };
+        const int32_t dy = 67, top = 443;
+        for (const auto &range : ranges) {
+            YScale s = yScale(range[0], range[1], dy);
+            std::vector<int16_t> ys(POINTS), ref(POINTS);
+            double before = timeMicros([&] {
+                for (int i = 0; i < POINTS; i++) ref[i] = referencePlotY(values[i], s, top);
+                sink = ref[POINTS - 1];
+            });
+            double after = timeMicros([&] {
+                seriesToPixels(values.data(), POINTS, s.lo, s.hi, s.shift, s.scaleQ15, top, ys.data());
+                sink = ys[POINTS - 1];
+            });
+            char name[32];
+            snprintf(name, sizeof(name), "  %ld..%ld", (long)s.lo, (long)s.hi);
+            bool ok = ys == ref;
+            for (int16_t y : ref) ok &= y >= top && y <= top + dy;
+            report(name, before, after, ok);
+        }
+    }
+
+    // Moving average against the direct sum over each window
+    {
+        const int window = 5;
+        std::vector<int16_t> smooth(POINTS), ref(POINTS);
+        double before = timeMicros([&] {
+            for (int i = 0; i < POINTS; i++) {
+                int32_t sum = 0, count = 0;
+                for (int j = i - window / 2; j <= i + window / 2; j++) {
+                    if (j < 0 || j >= POINTS) continue;
+                    sum += values[j];
+                    count++;
+                }
+                ref[i] = (int16_t)((sum + (sum >= 0 ? count / 2 : -(count / 2))) / count);
+            }
+            sink = ref[0];
+        });
+        double after = timeMicros([&] {
+            seriesMovingAverage(values.data(), POINTS, window, smooth.data());
+            sink = smooth[0];
+        });
+        report("moving average", before, after, smooth == ref);
+    }
+
+    // Dew point against double precision
+    {
+        std::vector<int16_t> dew(POINTS);
+        double after = timeMicros([&] {
+            seriesDewPoint(values.data(), humidity.data(), POINTS, dew.data());
+            sink = dew[0];
+        });
+        bool close = true;
+        for (int i = 0; i < POINTS; i++) {
+            double t = values[i] / 10.0;
+            double gamma = std::log(humidity[i] / 100.0) + 17.625 * t / (243.04 + t);
+            double expected = 10 * 243.04 * gamma / (17.625 - gamma);
+            close &= std::fabs(dew[i] - expected) <= 1.0;
+        }
+        printf("%-16s %11s -> %8.3f us  %s\n", "dew point", "", after, close ? "within 0.1 degree" : "MISMATCH");
+        if (!close) exit(1);
+    }
+    return 0;
+}
@@ -0,0 +1,72 @@
+#include "alloc_counter.h"
+
+#ifdef ENABLE_BENCHMARKS
+
+#include "utils.h"
+#include <Arduino.h>
+#include <atomic>
+
+static std::atomic<uint32_t> allocations(0);
+
+// Both cores allocate
+static inline void countAllocation() {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+extern "C" {
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void *__real_heap_caps_malloc(size_t size, uint32_t caps);
+void *__real_heap_caps_calloc(size_t count, size_t size, uint32_t caps);
+void *__real_heap_caps_realloc(void *ptr, size_t size, uint32_t caps);
+
+void *__wrap_malloc(size_t size) {
+    countAllocation();
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+    countAllocation();
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    countAllocation();
+    return __real_realloc(ptr, size);
+}
+
+void *__wrap_heap_caps_malloc(size_t size, uint32_t caps) {
+    countAllocation();
+    return __real_heap_caps_malloc(size, caps);
+}
+
+void *__wrap_heap_caps_calloc(size_t count, size_t size, uint32_t caps) {
+    countAllocation();
+    return __real_heap_caps_calloc(count, size, caps);
+}
+
+void *__wrap_heap_caps_realloc(void *ptr, size_t size, uint32_t caps) {
+    countAllocation();
+    return __real_heap_caps_realloc(ptr, size, caps);
+}
+}
+
+uint32_t heapAllocationCount() {
+    return allocations.load(std::memory_order_relaxed);
+}
+
+AllocationCheck::AllocationCheck(const char *what, bool enabled)
+    : what(what), enabled(enabled), startCount(heapAllocationCount()) {}
+
+AllocationCheck::~AllocationCheck() {
+    if (!enabled) return;
+    uint32_t count = heapAllocationCount() - startCount;
+    if (count == 0) {
+        logPrintf("%s: no heap allocations\n", what);
+    } else {
+        logPrintf("WARNING: %s made %u heap allocations\n", what, (unsigned)count);
+    }
+}
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef ALLOC_COUNTER_H
+#define ALLOC_COUNTER_H
+
+#include <stdint.h>
+
+// Heap allocation counter for the PaperS3-bench environment, which links with
+// -Wl,--wrap for malloc/calloc/realloc and their heap_caps_* versions. Other
+// builds get an AllocationCheck that does nothing.
+#ifdef ENABLE_BENCHMARKS
+
+// Allocations made through the wrapped functions since boot
+uint32_t heapAllocationCount();
+
+// Logs how many heap allocations were made during its lifetime
+class AllocationCheck {
+public:
+    explicit AllocationCheck(const char *what, bool enabled = true);
+    ~AllocationCheck();
+
+private:
+    const char *what;
+    bool enabled;
+    uint32_t startCount;
+};
+
+#else
+
+class AllocationCheck {
+public:
+    explicit AllocationCheck(const char *, bool = true) {}
+};
+
+#endif
+
+#endif // ALLOC_COUNTER_H
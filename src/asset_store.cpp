@@ -0,0 +1,74 @@
+#include "asset_store.h"
+#include "constants.h"
+#include <Arduino.h>
+#include <esp_partition.h>
+#include <esp_rom_crc.h>
+
+static const uint8_t *blob = nullptr;
+static const AssetHeader *header = nullptr;
+static bool attempted = false;
+
+static bool mapPartition() {
+    const esp_partition_t *partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                                                (esp_partition_subtype_t)ASSET_PARTITION_SUBTYPE,
+                                                                ASSET_PARTITION_LABEL);
+    if (partition == nullptr) {
+        Serial.println("Asset partition not found");
+        return false;
+    }
+
+    // Mapped for the life of the firmware: entries are read in place
+    const void *mapped = nullptr;
+    spi_flash_mmap_handle_t handle;
+    if (esp_partition_mmap(partition, 0, partition->size, SPI_FLASH_MMAP_DATA, &mapped, &handle) != ESP_OK) {
+        Serial.println("Asset partition could not be mapped");
+        return false;
+    }
+
+    const AssetHeader *h = (const AssetHeader *)mapped;
+    bool valid = h->magic == ASSET_MAGIC && h->version == ASSET_FORMAT_VERSION &&
+                 h->size <= partition->size - sizeof(AssetHeader) &&
+                 (uint32_t)h->count * sizeof(AssetEntry) <= h->size &&
+                 esp_rom_crc32_le(0, (const uint8_t *)(h + 1), h->size) == h->crc;
+    if (!valid) {
+        Serial.println("Asset partition empty or corrupt - flash it with `pio run -t upload_assets`");
+        spi_flash_munmap(handle);
+        return false;
+    }
+    if (h->count != ASSET_COUNT) {
+        Serial.printf("Asset partition has %u entries, firmware expects %u - reflash the assets\n",
+                      (unsigned)h->count, (unsigned)ASSET_COUNT);
+        spi_flash_munmap(handle);
+        return false;
+    }
+
+    blob = (const uint8_t *)mapped;
+    header = h;
+    Serial.printf("Assets: %u entries, %u bytes, crc %08x\n",
+                  (unsigned)h->count, (unsigned)h->size, (unsigned)h->crc);
+    return true;
+}
+
+bool openAssetStore() {
+    if (header == nullptr && !attempted) {
+        attempted = true;
+        mapPartition();
+    }
+    return header != nullptr;
+}
+
+bool findAsset(uint16_t id, AssetView &view) {
+    if (header == nullptr || id >= header->count) return false;
+    const AssetEntry &entry = ((const AssetEntry *)(header + 1))[id];
+    if (entry.offset < sizeof(AssetHeader) || entry.offset + entry.length > sizeof(AssetHeader) + header->size) {
+        return false;
+    }
+    view.data = blob + entry.offset;
+    view.length = entry.length;
+    view.codec = entry.codec;
+    return true;
+}
+
+uint32_t assetStoreKey() {
+    return openAssetStore() ? header->crc : 0;
+}
@@ -0,0 +1,62 @@
+#ifndef ASSET_STORE_H
+#define ASSET_STORE_H
+
+#include <stdint.h>
+#include "icon_images.h"
+
+// Read-only assets in the "assets" flash partition, built and flashed by
+// tools/gen_assets.py. The partition is memory-mapped once and entries are
+// read in place; it can be rewritten without reflashing the app
+// (`pio run -t upload_assets`).
+//
+// Layout, little-endian:
+//   AssetHeader
+//   AssetEntry[count]   indexed by asset id
+//   data                entries point into this
+// The CRC covers everything after the header.
+
+#define ASSET_MAGIC 0x31545341  // "AST1"
+#define ASSET_FORMAT_VERSION 1
+#define ASSET_COUNT ICON_ASSET_COUNT  // Asset ids: the icons (icon_images.h), nothing else yet
+
+enum AssetCodec : uint8_t {
+    ASSET_RAW,
+    ASSET_RLE_ROWS    // frame_codec.h rows
+};
+
+struct AssetHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+    uint32_t size;       // Index + data bytes
+    uint32_t crc;
+};
+
+struct AssetEntry {
+    uint32_t offset;     // From the start of the blob
+    uint16_t length;
+    uint8_t codec;       // AssetCodec
+    uint8_t reserved;
+};
+
+static_assert(sizeof(AssetHeader) == 16, "asset header layout");
+static_assert(sizeof(AssetEntry) == 8, "asset index layout");
+
+struct AssetView {
+    const uint8_t *data;
+    uint16_t length;
+    uint8_t codec;
+};
+
+// Map and verify the partition on first use; false if it is missing, fails
+// its CRC or does not hold the ASSET_COUNT entries this firmware expects
+bool openAssetStore();
+
+// Entry in the mapped blob; false if the store is not open or id is out of range
+bool findAsset(uint16_t id, AssetView &view);
+
+// CRC of the blob, so caches of rendered assets notice an update; 0 without
+// a valid partition
+uint32_t assetStoreKey();
+
+#endif // ASSET_STORE_H
@@ -0,0 +1,301 @@
+#include "astro.h"
+#include "timezone.h"
+#include "constants.h"
+#include "config.h"
+#include "utils.h"
+#include <Arduino.h>
+#include <Preferences.h>
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+
+extern Preferences preferences;
+
+#define RADIANS_PER_DEGREE (M_PI / 180.0)
+#define DEGREES_PER_RADIAN (180.0 / M_PI)
+#define J2000 2451545.0
+#define SUN_RISE_ALTITUDE -0.833     // Refraction plus the solar semi-diameter
+#define CIVIL_TWILIGHT_ALTITUDE -6.0
+#define MOON_RISE_ALTITUDE 0.133     // Lunar semi-diameter less parallax, as in suncalc
+#define SUN_DISTANCE_KM 149598000.0
+#define EARTH_OBLIQUITY (23.4397 * RADIANS_PER_DEGREE)
+
+// Julian day at 0h UTC of a Gregorian date
+static double julianDay(int year, int month, int mday) {
+    if (month <= 2) {
+        year -= 1;
+        month += 12;
+    }
+    int a = year / 100;
+    int b = 2 - a + a / 4;
+    return floor(365.25 * (year + 4716)) + floor(30.6001 * (month + 1)) + mday + b - 1524.5;
+}
+
+// ---- Sun (NOAA solar calculator equations) ----
+
+struct SolarPosition {
+    double declination;       // Radians
+    double equationOfTime;    // Minutes
+};
+
+static SolarPosition solarPosition(double jd) {
+    double t = (jd - J2000) / 36525.0;
+    double l0 = fmod(280.46646 + t * (36000.76983 + t * 0.0003032), 360.0) * RADIANS_PER_DEGREE;
+    double m = (357.52911 + t * (35999.05029 - 0.0001537 * t)) * RADIANS_PER_DEGREE;
+    double e = 0.016708634 - t * (0.000042037 + 0.0000001267 * t);
+
+    double center = sin(m) * (1.914602 - t * (0.004817 + 0.000014 * t)) +
+                    sin(2 * m) * (0.019993 - 0.000101 * t) + sin(3 * m) * 0.000289;
+    double omega = (125.04 - 1934.136 * t) * RADIANS_PER_DEGREE;
+    double lambda = l0 + (center - 0.00569 - 0.00478 * sin(omega)) * RADIANS_PER_DEGREE;
+    double epsilon0 = 23.0 + (26.0 + (21.448 - t * (46.815 + t * (0.00059 - t * 0.001813))) / 60.0) / 60.0;
+    double epsilon = (epsilon0 + 0.00256 * cos(omega)) * RADIANS_PER_DEGREE;
+
+    double y = tan(epsilon / 2);
+    y *= y;
+
+    SolarPosition pos;
+    pos.declination = asin(sin(epsilon) * sin(lambda));
+    pos.equationOfTime = 4.0 * DEGREES_PER_RADIAN *
+        (y * sin(2 * l0) - 2 * e * sin(m) + 4 * e * y * sin(m) * cos(2 * l0) -
+         0.5 * y * y * sin(4 * l0) - 1.25 * e * e * sin(2 * m));
+    return pos;
+}
+
+// Minutes after local midnight (jd0) at which the sun crosses the altitude,
+// rising (direction -1), setting (+1) or culminating (0). NAN if it never
+// crosses it that day. The first guess is refined once at the event itself.
+static double solarEvent(double jd0, double latitude, double longitude, int utcOffset,
+                         double altitude, int direction) {
+    double lat = latitude * RADIANS_PER_DEGREE;
+    double minute = 720 + utcOffset - 4 * longitude;
+
+    for (int pass = 0; pass < 2; pass++) {
+        SolarPosition pos = solarPosition(jd0 + minute / 1440.0);
+        double noon = 720 + utcOffset - 4 * longitude - pos.equationOfTime;
+        double cosH = (sin(altitude * RADIANS_PER_DEGREE) - sin(lat) * sin(pos.declination)) /
+                      (cos(lat) * cos(pos.declination));
+        if (direction != 0 && (cosH < -1 || cosH > 1)) return NAN;
+        minute = direction == 0 ? noon : noon + direction * 4 * DEGREES_PER_RADIAN * acos(cosH);
+    }
+    return minute;
+}
+
+// Round to whole minutes within the day
+static int16_t dayMinutes(double minute) {
+    if (isnan(minute)) return ASTRO_NONE;
+    long m = lround(minute) % 1440;
+    return m < 0 ? m + 1440 : m;
+}
+
+// ---- Moon (low-precision series, after Meeus and suncalc) ----
+
+struct Equatorial {
+    double rightAscension;    // Radians
+    double declination;
+    double distance;          // km
+};
+
+static Equatorial fromEcliptic(double longitude, double latitude, double distance) {
+    Equatorial eq;
+    eq.rightAscension = atan2(sin(longitude) * cos(EARTH_OBLIQUITY) - tan(latitude) * sin(EARTH_OBLIQUITY),
+                              cos(longitude));
+    eq.declination = asin(sin(latitude) * cos(EARTH_OBLIQUITY) +
+                          cos(latitude) * sin(EARTH_OBLIQUITY) * sin(longitude));
+    eq.distance = distance;
+    return eq;
+}
+
+// d: days since J2000
+static Equatorial moonPosition(double d) {
+    double l = (218.316 + 13.176396 * d) * RADIANS_PER_DEGREE;   // Mean longitude
+    double m = (134.963 + 13.064993 * d) * RADIANS_PER_DEGREE;   // Mean anomaly
+    double f = (93.272 + 13.229350 * d) * RADIANS_PER_DEGREE;    // Mean distance from the node
+    return fromEcliptic(l + 6.289 * RADIANS_PER_DEGREE * sin(m), 5.128 * RADIANS_PER_DEGREE * sin(f), 385001 - 20905 * cos(m));
+}
+
+static Equatorial sunPosition(double d) {
+    double m = (357.5291 + 0.98560028 * d) * RADIANS_PER_DEGREE;
+    double center = (1.9148 * sin(m) + 0.02 * sin(2 * m) + 0.0003 * sin(3 * m)) * RADIANS_PER_DEGREE;
+    double perihelion = 102.9372 * RADIANS_PER_DEGREE;
+    return fromEcliptic(m + center + perihelion + M_PI, 0, SUN_DISTANCE_KM);
+}
+
+// Apparent altitude of the moon in degrees
+static double moonAltitude(double d, double latitude, double longitude) {
+    Equatorial moon = moonPosition(d);
+    double lat = latitude * RADIANS_PER_DEGREE;
+    double hourAngle = (280.16 + 360.9856235 * d + longitude) * RADIANS_PER_DEGREE - moon.rightAscension;
+    double h = asin(sin(lat) * sin(moon.declination) + cos(lat) * cos(moon.declination) * cos(hourAngle));
+
+    // Atmospheric refraction (Saemundsson), taken as zero below the horizon
+    double clamped = h < 0 ? 0 : h;
+    h += 0.0002967 / tan(clamped + 0.00312536 / (clamped + 0.08901179));
+    return h * DEGREES_PER_RADIAN;
+}
+
+// Moonrise and moonset within the day starting at jd0, found by fitting a
+// parabola through the altitude every two hours
+static void moonEvents(double jd0, double latitude, double longitude, int16_t &rise, int16_t &set) {
+    double d0 = jd0 - J2000;
+    auto altitude = [&](double hours) {
+        return moonAltitude(d0 + hours / 24.0, latitude, longitude) - MOON_RISE_ALTITUDE;
+    };
+
+    double riseHour = NAN, setHour = NAN;
+    double h0 = altitude(0);
+    for (int i = 1; i <= 24 && (isnan(riseHour) || isnan(setHour)); i += 2) {
+        double h1 = altitude(i);
+        double h2 = altitude(i + 1);
+
+        double a = (h0 + h2) / 2 - h1;
+        double b = (h2 - h0) / 2;
+        double xe = -b / (2 * a);
+        double ye = (a * xe + b) * xe + h1;
+        double discriminant = b * b - 4 * a * h1;
+
+        if (a != 0 && discriminant >= 0) {
+            double dx = sqrt(discriminant) / (fabs(a) * 2);
+            double x1 = xe - dx, x2 = xe + dx;
+            int roots = (fabs(x1) <= 1) + (fabs(x2) <= 1);
+            if (x1 < -1) x1 = x2;
+
+            if (roots == 1) {
+                if (h0 < 0) {
+                    if (isnan(riseHour)) riseHour = i + x1;
+                } else {
+                    if (isnan(setHour)) setHour = i + x1;
+                }
+            } else if (roots == 2) {
+                if (isnan(riseHour)) riseHour = i + (ye < 0 ? x2 : x1);
+                if (isnan(setHour)) setHour = i + (ye < 0 ? x1 : x2);
+            }
+        }
+        h0 = h2;
+    }
+
+    // A root at exactly 24 h belongs to the next day
+    rise = isnan(riseHour) ? ASTRO_NONE : std::min(lround(riseHour * 60), 1439L);
+    set = isnan(setHour) ? ASTRO_NONE : std::min(lround(setHour * 60), 1439L);
+}
+
+// Phase (0 new, 0.5 full) and lit fraction of the disc
+static void moonIllumination(double d, double &phase, double &fraction) {
+    Equatorial sun = sunPosition(d);
+    Equatorial moon = moonPosition(d);
+    double dra = sun.rightAscension - moon.rightAscension;
+
+    double elongation = acos(sin(sun.declination) * sin(moon.declination) +
+                             cos(sun.declination) * cos(moon.declination) * cos(dra));
+    double incidence = atan2(sun.distance * sin(elongation), moon.distance - sun.distance * cos(elongation));
+    double angle = atan2(cos(sun.declination) * sin(dra),
+                         sin(sun.declination) * cos(moon.declination) -
+                         cos(sun.declination) * sin(moon.declination) * cos(dra));
+
+    fraction = (1 + cos(incidence)) / 2;
+    phase = 0.5 + 0.5 * incidence * (angle < 0 ? -1 : 1) / M_PI;
+}
+
+void computeAstroDay(AstroDay &day, int year, int month, int mday,
+                     float latitude, float longitude, int utcOffsetMinutes) {
+    // UTC instant of local midnight; event times are minutes after it
+    double jd0 = julianDay(year, month, mday) - utcOffsetMinutes / 1440.0;
+
+    day.date = year * 10000 + month * 100 + mday;
+    day.latitude = latitude;
+    day.longitude = longitude;
+    day.utcOffset = utcOffsetMinutes;
+
+    day.dawn = dayMinutes(solarEvent(jd0, latitude, longitude, utcOffsetMinutes, CIVIL_TWILIGHT_ALTITUDE, -1));
+    day.sunrise = dayMinutes(solarEvent(jd0, latitude, longitude, utcOffsetMinutes, SUN_RISE_ALTITUDE, -1));
+    day.solarNoon = dayMinutes(solarEvent(jd0, latitude, longitude, utcOffsetMinutes, 0, 0));
+    day.sunset = dayMinutes(solarEvent(jd0, latitude, longitude, utcOffsetMinutes, SUN_RISE_ALTITUDE, 1));
+    day.dusk = dayMinutes(solarEvent(jd0, latitude, longitude, utcOffsetMinutes, CIVIL_TWILIGHT_ALTITUDE, 1));
+
+    // No sunrise: polar day if the sun is above the horizon at noon
+    SolarPosition noon = solarPosition(jd0 + 0.5);
+    double lat = latitude * RADIANS_PER_DEGREE;
+    double noonAltitude = asin(sin(lat) * sin(noon.declination) + cos(lat) * cos(noon.declination)) * DEGREES_PER_RADIAN;
+    day.polarDay = day.sunrise == ASTRO_NONE && noonAltitude > SUN_RISE_ALTITUDE;
+
+    moonEvents(jd0, latitude, longitude, day.moonrise, day.moonset);
+
+    double phase, fraction;
+    moonIllumination(jd0 + 0.5 - J2000, phase, fraction);
+    day.moonPhase = (uint16_t)lround(phase * 1000) % 1000;
+    day.moonIllumination = (uint8_t)lround(fraction * 100);
+}
+
+// ---- Daily cache ----
+
+// Until updateAstro() has run: the default hours, new moon
+static AstroDay today = {
+    0, COORD_NOT_SET, COORD_NOT_SET, 0,
+    ASTRO_NONE, DEFAULT_SUNRISE_HOUR * 60, 12 * 60, DEFAULT_SUNSET_HOUR * 60, ASTRO_NONE, false,
+    ASTRO_NONE, ASTRO_NONE, 0, 0
+};
+
+static void logDay(const AstroDay &day, unsigned long elapsed) {
+    char dawn[8], rise[8], set[8], dusk[8], moonrise[8], moonset[8];
+    logPrintf("Astro %ld: dawn %s, sun %s-%s, dusk %s; moon %u%% lit, %s-%s (%lu us)\n", (long)day.date,
+              formatMinutes(dawn, sizeof(dawn), day.dawn), formatMinutes(rise, sizeof(rise), day.sunrise),
+              formatMinutes(set, sizeof(set), day.sunset), formatMinutes(dusk, sizeof(dusk), day.dusk),
+              day.moonIllumination, formatMinutes(moonrise, sizeof(moonrise), day.moonrise),
+              formatMinutes(moonset, sizeof(moonset), day.moonset), elapsed);
+}
+
+static void computeToday(int year, int month, int mday, float latitude, float longitude, int utcOffset) {
+    unsigned long start = micros();
+    computeAstroDay(today, year, month, mday, latitude, longitude, utcOffset);
+    logDay(today, micros() - start);
+
+    preferences.begin("weather", false);
+    preferences.putBytes(ASTRO_CACHE_KEY, &today, sizeof(today));
+    preferences.end();
+}
+
+void updateAstro() {
+    time_t now = time(nullptr);
+    if (now < MIN_VALID_EPOCH) {
+        Serial.println("No valid time, using default sunrise and sunset");
+        return;
+    }
+    struct tm local;
+    localtime_r(&now, &local);
+    int32_t date = (local.tm_year + 1900) * 10000 + (local.tm_mon + 1) * 100 + local.tm_mday;
+
+    float latitude = hasCoordinates() ? config.latitude : DEFAULT_LATITUDE;
+    float longitude = hasCoordinates() ? config.longitude : DEFAULT_LONGITUDE;
+
+    int utcOffset = utcOffsetMinutesAt(now);
+    AstroDay cached;
+    preferences.begin("weather", true);
+    bool found = preferences.getBytes(ASTRO_CACHE_KEY, &cached, sizeof(cached)) == sizeof(cached);
+    preferences.end();
+
+    // The cached times are local, so a zone or DST change invalidates them too
+    if (found && cached.date == date && cached.latitude == latitude && cached.longitude == longitude &&
+        cached.utcOffset == utcOffset) {
+        today = cached;
+        return;
+    }
+
+    computeToday(local.tm_year + 1900, local.tm_mon + 1, local.tm_mday, latitude, longitude, utcOffset);
+}
+
+void setAstroUtcOffset(int minutes) {
+    if (today.date == 0 || today.utcOffset == minutes) return;
+    computeToday(today.date / 10000, today.date / 100 % 100, today.date % 100,
+                 today.latitude, today.longitude, minutes);
+}
+
+const AstroDay &astroToday() {
+    return today;
+}
+
+bool sunIsUp(const AstroDay &day, int minute) {
+    if (day.sunrise == ASTRO_NONE || day.sunset == ASTRO_NONE) return day.polarDay;
+    if (day.sunrise <= day.sunset) return minute >= day.sunrise && minute < day.sunset;
+    // Far enough from the time zone's meridian that sunset wraps past midnight
+    return minute >= day.sunrise || minute < day.sunset;
+}
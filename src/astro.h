@@ -0,0 +1,51 @@
+#ifndef ASTRO_H
+#define ASTRO_H
+
+#include <stdint.h>
+
+// Offline sun and moon ephemeris for the configured location. Event times are
+// computed once per local day (NOAA solar equations, low-precision lunar
+// series) and cached in NVS, so wakes without a forecast download still know
+// when the sun is up and what the moon is doing.
+
+#define ASTRO_NONE -1  // Event does not happen on this day
+
+// One local day; times are minutes after local midnight
+struct AstroDay {
+    int32_t date;               // Local date as YYYYMMDD
+    float latitude;             // Inputs the day was computed for
+    float longitude;
+    int16_t utcOffset;          // Minutes east of UTC
+
+    int16_t dawn;               // Civil twilight (sun 6 degrees below the horizon)
+    int16_t sunrise;
+    int16_t solarNoon;
+    int16_t sunset;
+    int16_t dusk;
+    bool polarDay;              // With no sunrise: the sun stays up all day
+
+    int16_t moonrise;
+    int16_t moonset;
+    uint16_t moonPhase;         // Permille of the lunation at local noon: 0 new, 500 full
+    uint8_t moonIllumination;   // Percent of the disc lit at local noon
+};
+
+// Fill in every event of the given local date
+void computeAstroDay(AstroDay &day, int year, int month, int mday,
+                     float latitude, float longitude, int utcOffsetMinutes);
+
+// Load today's events from the cache, or compute and store them. Needs the
+// system time; the coordinates come from the settings.
+void updateAstro();
+
+// UTC offset of the location as reported by the forecast; recomputes the day
+// if it differs from the one it was computed with
+void setAstroUtcOffset(int minutes);
+
+// Events for today, as of the last updateAstro() (default hours before that)
+const AstroDay &astroToday();
+
+// Whether the sun is up at the given minute after local midnight
+bool sunIsUp(const AstroDay &day, int minute);
+
+#endif // ASTRO_H
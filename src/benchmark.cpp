@@ -0,0 +1,291 @@
+#include "benchmark.h"
+
+#ifdef ENABLE_BENCHMARKS
+
+#include "constants.h"
+#include "display.h"
+#include "glyphs.h"
+#include "displaylist.h"
+#include "canvas_backend.h"
+#include "tile_render.h"
+#include "framestore.h"
+#include <M5Unified.h>
+#include <esp_rom_crc.h>
+
+extern M5Canvas canvas;
+extern DisplayList displayList;
+extern DisplayList previousList;
+
+// Average microseconds per call of fn over the given number of iterations
+template <typename F>
+static uint32_t timeMicros(int iterations, F &&fn) {
+    unsigned long start = micros();
+    for (int i = 0; i < iterations; i++) {
+        fn(i);
+    }
+    return (micros() - start) / iterations;
+}
+
+static void report(const char *name, uint32_t before, uint32_t after) {
+    Serial.printf("  %-22s %7lu us -> %7lu us  (%.1fx)\n", name, (unsigned long)before,
+                  (unsigned long)after, after > 0 ? (float)before / after : 0.0f);
+}
+
+// ---- Reference implementations the widgets used before fixed-point trig ----
+
+static void legacyDrawRSSI(int x, int y) {
+    auto drawArc = [&](int cx, int cy, int r, int fromDeg, int toDeg) {
+        for (int i = fromDeg; i < toDeg; i++) {
+            double rad = i * PI / 180;
+            int px = cx + r * cos(rad);
+            int py = cy + r * sin(rad);
+            canvas.drawPixel(px, py, TFT_BLACK);
+        }
+    };
+    for (int r : { 16, 12, 8, 4, 2 }) {
+        drawArc(x + 12, y, r, 225, 315);
+    }
+}
+
+static void legacyDrawArrow(int x, int y, int asize, float aangle, int pwidth, int plength) {
+    float dx = (asize + 21) * cos((aangle - 90) * PI / 180) + x;
+    float dy = (asize + 21) * sin((aangle - 90) * PI / 180) + y;
+    float x1 = 0;           float y1 = plength;
+    float x2 = pwidth / 2;  float y2 = pwidth / 2;
+    float x3 = -pwidth / 2; float y3 = pwidth / 2;
+    float angle = aangle * PI / 180;
+    float xx1 = x1 * cos(angle) - y1 * sin(angle) + dx;
+    float yy1 = y1 * cos(angle) + x1 * sin(angle) + dy;
+    float xx2 = x2 * cos(angle) - y2 * sin(angle) + dx;
+    float yy2 = y2 * cos(angle) + x2 * sin(angle) + dy;
+    float xx3 = x3 * cos(angle) - y3 * sin(angle) + dx;
+    float yy3 = y3 * cos(angle) + x3 * sin(angle) + dy;
+    canvas.fillTriangle(xx1, yy1, xx3, yy3, xx2, yy2, TFT_BLACK);
+}
+
+static void legacyDrawCompassRose(int x, int y, int radius) {
+    int dxo, dyo, dxi, dyi;
+    canvas.drawCircle(x, y, radius, TFT_BLACK);
+    canvas.drawCircle(x, y, radius + 1, TFT_BLACK);
+    canvas.drawCircle(x, y, radius * 0.7, TFT_BLACK);
+    for (float a = 0; a < 360; a += 22.5) {
+        dxo = radius * cos((a - 90) * PI / 180);
+        dyo = radius * sin((a - 90) * PI / 180);
+        dxi = dxo * 0.9;
+        dyi = dyo * 0.9;
+        canvas.drawLine(dxo + x, dyo + y, dxi + x, dyi + y, TFT_BLACK);
+        dxo = dxo * 0.7;
+        dyo = dyo * 0.7;
+        dxi = dxo * 0.9;
+        dyi = dyo * 0.9;
+        canvas.drawLine(dxo + x, dyo + y, dxi + x, dyi + y, TFT_BLACK);
+    }
+}
+
+static void legacyDrawMainTemp(int x, int y, int temp) {
+    canvas.setFont(&fonts::FreeSansBold24pt7b);
+    canvas.setTextSize(2);
+    canvas.setTextDatum(TC_DATUM);
+    String tempNum = String(temp);
+    canvas.drawString(tempNum, x, y);
+    int tempWidth = canvas.textWidth(tempNum) * 2;
+    for (int i = 0; i < 2; i++) {
+        canvas.drawCircle(x + tempWidth / 2 - 42, y + 13, 8 - i, TFT_BLACK);
+    }
+    canvas.setFont(nullptr);
+    canvas.setTextFont(1);
+    canvas.setTextSize(1);
+    canvas.setTextDatum(TL_DATUM);
+}
+
+// Current widgets record into the display list; time recording plus rasterising
+template <typename F>
+static void recordAndRasterise(F &&record) {
+    displayList.clear();
+    record();
+    rasteriseDisplayList(displayList, canvas);
+}
+
+// The current rose is drawWindCompassChrome() minus its labels, which both share
+static void currentDrawCompassRose(int x, int y, int radius) {
+    canvas.setClipRect(x - radius - 2, y - radius - 2, 2 * radius + 5, 2 * radius + 5);
+    recordAndRasterise([&] { drawWindCompassChrome(x, y, radius); });
+    canvas.clearClipRect();
+}
+
+static void benchmarkWidgets() {
+    const int iterations = 200;
+    const int cx = 120, cy = 120;
+
+    Serial.println("Widget rendering (per call):");
+
+    uint32_t before = timeMicros(iterations, [&](int) { legacyDrawRSSI(cx, cy); });
+    uint32_t after = timeMicros(iterations, [&](int) { recordAndRasterise([&] { drawRSSI(cx, cy, -40); }); });
+    report("drawRSSI (5 arcs)", before, after);
+
+    before = timeMicros(iterations, [&](int) { legacyDrawCompassRose(cx, cy, COMPASS_RADIUS); });
+    after = timeMicros(iterations, [&](int) { currentDrawCompassRose(cx, cy, COMPASS_RADIUS); });
+    report("compass rose", before, after);
+
+    before = timeMicros(iterations, [&](int i) {
+        legacyDrawArrow(cx, cy, COMPASS_RADIUS - 17, i % 360, COMPASS_ARROW_SIZE, COMPASS_ARROW_LENGTH);
+    });
+    after = timeMicros(iterations, [&](int i) {
+        recordAndRasterise([&] {
+            drawArrow(cx, cy, COMPASS_RADIUS - 17, i % 360, COMPASS_ARROW_SIZE, COMPASS_ARROW_LENGTH);
+        });
+    });
+    report("drawArrow", before, after);
+
+    before = timeMicros(iterations, [&](int i) { legacyDrawMainTemp(cx, 40, i % 100); });
+    after = timeMicros(iterations, [&](int i) {
+        char tempStr[8];
+        snprintf(tempStr, sizeof(tempStr), "%d\xB0", i % 100);
+        recordAndRasterise([&] { drawGlyphText(GLYPH_FONT_XL, tempStr, cx, 40, TC_DATUM); });
+    });
+    report("main temperature", before, after);
+
+    // Change detection: compare two rendered frames pixel by pixel, or the two
+    // display lists that produced them
+    static uint8_t previousPixels[240 * 240 / 2];
+    auto drawWind = [&](float angle, float speed) {
+        drawWindCompassChrome(cx, cy, COMPASS_RADIUS);
+        drawWindCompass(cx, cy, angle, speed, COMPASS_RADIUS);
+    };
+    recordAndRasterise([&] { drawWind(90, 12.5); });
+    memcpy(previousPixels, canvas.getBuffer(), sizeof(previousPixels));
+    previousList.assign(displayList.data(), displayList.size());
+    recordAndRasterise([&] { drawWind(135, 14.0); });
+
+    DrawBounds rects[MAX_DIRTY_RECTS];
+    before = timeMicros(iterations, [&](int) {
+        const uint8_t *pixels = (const uint8_t *)canvas.getBuffer();
+        volatile int changed = 0;
+        for (size_t i = 0; i < sizeof(previousPixels); i++) changed += pixels[i] != previousPixels[i];
+    });
+    after = timeMicros(iterations, [&](int) { diffDisplayLists(previousList, displayList, rects, MAX_DIRTY_RECTS); });
+    report("change detection", before, after);
+    previousList.clear();
+}
+
+// Rasterising the static layer's display list: full-screen PSRAM canvas
+// against BAND_HEIGHT-row strips in internal SRAM, and one core against
+// tiles on both cores. Also checks every variant produces the same pixels.
+static void benchmarkFrame() {
+    const int iterations = 5;
+
+    M5Canvas full(&M5.Display);
+    M5Canvas band(&M5.Display);
+    full.setColorDepth(CANVAS_COLOR_DEPTH);
+    full.setPsram(true);
+    band.setColorDepth(CANVAS_COLOR_DEPTH);
+    band.setPsram(false);
+    if (!full.createSprite(SCREEN_WIDTH, SCREEN_HEIGHT) || !band.createSprite(SCREEN_WIDTH, BAND_HEIGHT)) {
+        Serial.println("Band benchmark allocation failed");
+        return;
+    }
+
+    displayList.clear();
+    drawStaticLayer();
+
+    Serial.println("Frame rasterisation (static layer, per frame):");
+    uint32_t before = timeMicros(iterations, [&](int) {
+        full.fillSprite(TFT_WHITE);
+        rasteriseDisplayList(displayList, full);
+    });
+    uint32_t after = timeMicros(iterations, [&](int) {
+        for (int y = 0; y < SCREEN_HEIGHT; y += BAND_HEIGHT) {
+            band.fillSprite(TFT_WHITE);
+            rasteriseDisplayList(displayList, band, 0, y);
+        }
+    });
+    report("PSRAM frame -> bands", before, after);
+
+    const size_t rowBytes = SCREEN_WIDTH / 2;
+    bool identical = true;
+    for (int y = 0; y < SCREEN_HEIGHT; y += BAND_HEIGHT) {
+        int rows = min(BAND_HEIGHT, SCREEN_HEIGHT - y);
+        band.fillSprite(TFT_WHITE);
+        rasteriseDisplayList(displayList, band, 0, y);
+        identical &= memcmp(band.getBuffer(), (const uint8_t *)full.getBuffer() + y * rowBytes, rows * rowBytes) == 0;
+    }
+    Serial.printf("  Banded output %s the full frame\n", identical ? "matches" : "DIFFERS FROM");
+
+    // Same frame rasterised as tiles shared between both cores
+    const size_t frameBytes = rowBytes * SCREEN_HEIGHT;
+    full.fillSprite(TFT_WHITE);
+    rasteriseDisplayList(displayList, full);
+    uint32_t singleCrc = esp_rom_crc32_le(0, (const uint8_t *)full.getBuffer(), frameBytes);
+    after = timeMicros(iterations, [&](int) {
+        full.fillSprite(TFT_WHITE);
+        rasteriseDisplayListParallel(displayList, full);
+    });
+    report("1 core -> 2 cores", before, after);
+    bool same = esp_rom_crc32_le(0, (const uint8_t *)full.getBuffer(), frameBytes) == singleCrc;
+    Serial.printf("  Tiled output %s the single-core frame\n", same ? "matches" : "DIFFERS FROM");
+
+    band.deleteSprite();
+    full.deleteSprite();
+    displayList.clear();
+}
+
+// Frame restore: the snapshot goes into the EPD driver's buffer without being
+// refreshed, so a partial update after it must refresh only what was pushed
+// since. Checked through the area the driver would refresh on display().
+static void benchmarkFrameRestore() {
+    Serial.println("Frame restore:");
+    if (!canvas.createSprite(SCREEN_WIDTH, SCREEN_HEIGHT)) {
+        Serial.println("  Canvas allocation failed");
+        return;
+    }
+    displayList.clear();
+    drawStaticLayer();
+    canvas.fillSprite(TFT_WHITE);
+    rasteriseDisplayList(displayList, canvas);
+    saveFrameSnapshot();
+    canvas.deleteSprite();
+    displayList.clear();
+
+    unsigned long start = micros();
+    bool restored = restoreFrameSnapshot();
+    unsigned long elapsed = micros() - start;
+    int x, y, w, h;
+    bool pending = panelPendingRefresh(x, y, w, h);
+    Serial.printf("  Restore %s in %lu us, %s\n", restored ? "done" : "FAILED", elapsed,
+                  pending ? "leaves an area to refresh: MISMATCH" : "nothing left to refresh");
+
+    if (restored && !pending) {
+        // One small change, pushed the way the renderer pushes changed regions
+        const int changeW = 40, changeH = 20;
+        M5.Display.startWrite();
+        M5.Display.fillRect(100, 100, changeW, changeH, TFT_BLACK);
+        M5.Display.endWrite();
+        pending = panelPendingRefresh(x, y, w, h);
+        bool exact = pending && w * h == changeW * changeH;
+        Serial.printf("  A %dx%d change refreshes %d pixels: %s\n", changeW, changeH, pending ? w * h : 0,
+                      exact ? "only the change" : "MISMATCH");
+    }
+
+    // The next boot must not take the test frame for the glass contents
+    invalidateFrameSnapshot();
+}
+
+void runBenchmarks() {
+    Serial.println("\n========== Benchmarks ==========");
+
+    if (!canvas.createSprite(240, 240)) {
+        Serial.println("Benchmark canvas allocation failed");
+        return;
+    }
+    canvas.fillSprite(TFT_WHITE);
+    canvas.setTextColor(TFT_BLACK, TFT_WHITE);
+
+    benchmarkWidgets();
+
+    canvas.deleteSprite();
+    benchmarkFrame();
+    benchmarkFrameRestore();
+    Serial.println("================================\n");
+}
+
+#endif // ENABLE_BENCHMARKS
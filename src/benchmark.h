@@ -0,0 +1,10 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+// On-device micro-benchmarks, only built in the PaperS3-bench environment
+// (pio run -e PaperS3-bench -t upload && pio device monitor)
+#ifdef ENABLE_BENCHMARKS
+void runBenchmarks();
+#endif
+
+#endif // BENCHMARK_H
@@ -0,0 +1,274 @@
+#include "boot.h"
+#include "constants.h"
+#include "config.h"
+#include "display.h"
+#include "framestore.h"
+#include "astro.h"
+#include "utils.h"
+#include <WiFi.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+extern bool frameRestored;
+
+struct StageRecord {
+    uint32_t start;
+    uint32_t end;
+    StageStatus status;
+};
+
+// Stages other than WiFi, which runs in the background from the start
+struct StageSpec {
+    const char *name;
+    uint8_t after;           // Bit mask of stages that must have finished first
+    bool needsWiFi;
+    uint32_t budget;         // Expected worst case in ms; network stages time out at it,
+                             // local ones run to completion and are flagged in the timeline
+    StageStatus (*run)();
+};
+
+static StageRecord records[STAGE_COUNT];
+static BootResult result;
+static bool wokeByTimer;
+
+static constexpr uint8_t stageBit(BootStage stage) { return 1 << stage; }
+
+static bool finished(BootStage stage) {
+    return records[stage].status >= STATUS_DONE;
+}
+
+// ---- WiFi ----
+// Association runs in the WiFi task; its events wake the loop task, which
+// otherwise only sleeps until the current attempt's deadline.
+
+enum WiFiPhase : uint8_t { WIFI_ASSOCIATING, WIFI_BACKOFF, WIFI_FINISHED };
+
+static TaskHandle_t bootTask = nullptr;
+static volatile bool wifiGotIp = false;
+static volatile bool wifiDropped = false;
+static WiFiPhase wifiPhase;
+static int wifiAttempt;
+static uint32_t wifiDeadline;
+
+static void onWiFiEvent(WiFiEvent_t event, WiFiEventInfo_t info) {
+    if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) {
+        wifiGotIp = true;
+    } else if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED) {
+        wifiDropped = true;
+    } else {
+        return;
+    }
+    if (bootTask) xTaskNotifyGive(bootTask);
+}
+
+static void finishWiFi(StageStatus status) {
+    records[STAGE_WIFI].end = millis();
+    records[STAGE_WIFI].status = status;
+    wifiPhase = WIFI_FINISHED;
+    result.connected = status == STATUS_DONE;
+}
+
+static void startWiFiAttempt() {
+    wifiGotIp = false;
+    wifiDropped = false;
+    if (!beginWiFi()) {
+        Serial.println("No WiFi credentials stored");
+        finishWiFi(STATUS_SKIPPED);
+        return;
+    }
+    wifiPhase = WIFI_ASSOCIATING;
+    wifiDeadline = millis() + WIFI_TIMEOUT_MS;
+}
+
+static void pollWiFi() {
+    uint32_t now = millis();
+
+    if (wifiPhase == WIFI_ASSOCIATING) {
+        if (wifiGotIp) {
+            Serial.printf("WiFi connected: %s\n", WiFi.localIP().toString().c_str());
+            finishWiFi(STATUS_DONE);
+            return;
+        }
+        if (!wifiDropped && (int32_t)(now - wifiDeadline) < 0) return;
+
+        Serial.printf("WiFi attempt %d/%d %s\n", wifiAttempt + 1, WIFI_RETRY_ATTEMPTS,
+                      wifiDropped ? "failed" : "timed out");
+        StageStatus status = wifiDropped ? STATUS_FAILED : STATUS_TIMEOUT;
+        WiFi.disconnect();
+        if (++wifiAttempt >= WIFI_RETRY_ATTEMPTS) {
+            Serial.println("All WiFi connection attempts failed");
+            finishWiFi(status);
+            return;
+        }
+        wifiPhase = WIFI_BACKOFF;
+        wifiDeadline = now + WIFI_RETRY_DELAY_MS;
+    } else if (wifiPhase == WIFI_BACKOFF && (int32_t)(now - wifiDeadline) >= 0) {
+        startWiFiAttempt();
+    }
+}
+
+// ---- Stages ----
+
+static StageStatus runTime() {
+    setupTime();
+    return time(nullptr) >= MIN_VALID_EPOCH ? STATUS_DONE : STATUS_FAILED;
+}
+
+static StageStatus runScreen() {
+    // On timer wakes the glass still shows the last dashboard: hand it back to the
+    // EPD driver so the upcoming refresh can be partial. Manual boots start clean.
+    if (wokeByTimer) {
+        frameRestored = restoreFrameSnapshot();
+    }
+
+    // Keep the old dashboard on screen instead of flashing a splash over it
+    if (!frameRestored) {
+        showSplashScreen();
+    }
+    return STATUS_DONE;
+}
+
+static StageStatus runChrome() {
+    // Falls back to banded rendering later if the canvas does not fit
+    return prepareFrame() ? STATUS_DONE : STATUS_FAILED;
+}
+
+static StageStatus runNtp() {
+    // RTC was never set: now that WiFi is up, fall back to NTP
+    if (time(nullptr) >= MIN_VALID_EPOCH) return STATUS_SKIPPED;
+    setupTime();
+    return time(nullptr) >= MIN_VALID_EPOCH ? STATUS_DONE : STATUS_TIMEOUT;
+}
+
+static StageStatus runGeocode() {
+    if (hasCoordinates()) return STATUS_SKIPPED;
+    return resolveCoordinates(result.latitude, result.longitude) ? STATUS_DONE : STATUS_FAILED;
+}
+
+static StageStatus runAstro() {
+    updateAstro();
+    return astroToday().date != 0 ? STATUS_DONE : STATUS_FAILED;
+}
+
+// A frame restore borrows the canvas the static layer is rendered into
+static const StageSpec STAGES[STAGE_COUNT] = {
+    { "wifi",    0,                      false, WIFI_RETRY_ATTEMPTS * (WIFI_TIMEOUT_MS + WIFI_RETRY_DELAY_MS), nullptr },
+    { "time",    0,                      false, BOOT_TIME_BUDGET_MS,   runTime },
+    { "screen",  0,                      false, BOOT_SCREEN_BUDGET_MS, runScreen },
+    { "chrome",  stageBit(STAGE_SCREEN), false, BOOT_CHROME_BUDGET_MS, runChrome },
+    { "ntp",     stageBit(STAGE_TIME),   true,  NTP_TIMEOUT_MS,        runNtp },
+    { "geocode", 0,                      true,  HTTP_RETRY_ATTEMPTS * (HTTP_TIMEOUT_MS + HTTP_RETRY_DELAY_MS), runGeocode },
+    { "astro",   stageBit(STAGE_TIME) | stageBit(STAGE_NTP) | stageBit(STAGE_GEOCODE), false, BOOT_ASTRO_BUDGET_MS, runAstro },
+};
+
+static bool runnable(int stage) {
+    const StageSpec &spec = STAGES[stage];
+    if (records[stage].status != STATUS_PENDING) return false;
+    for (int dep = 0; dep < STAGE_COUNT; dep++) {
+        if ((spec.after & (1 << dep)) && !finished((BootStage)dep)) return false;
+    }
+    return !spec.needsWiFi || finished(STAGE_WIFI);
+}
+
+// Network stages first, so the radio is needed for as short a time as possible
+static int nextStage() {
+    for (int pass = 0; pass < 2; pass++) {
+        for (int stage = STAGE_WIFI + 1; stage < STAGE_COUNT; stage++) {
+            if (STAGES[stage].needsWiFi == (pass == 0) && runnable(stage)) return stage;
+        }
+    }
+    return -1;
+}
+
+static void runStage(int stage) {
+    StageRecord &record = records[stage];
+    record.start = millis();
+    if (STAGES[stage].needsWiFi && !result.connected) {
+        record.status = STATUS_SKIPPED;
+    } else {
+        record.status = STATUS_RUNNING;
+        record.status = STAGES[stage].run();
+    }
+    record.end = millis();
+}
+
+// ---- Timeline ----
+
+static const char *statusName(StageStatus status) {
+    switch (status) {
+        case STATUS_DONE:    return "done";
+        case STATUS_FAILED:  return "failed";
+        case STATUS_TIMEOUT: return "timeout";
+        case STATUS_SKIPPED: return "skipped";
+        default:             return "pending";
+    }
+}
+
+static void printTimeline(uint32_t bootStart, uint32_t bootEnd) {
+    uint32_t total = bootEnd - bootStart;
+    uint32_t sequential = 0;
+    for (const StageRecord &record : records) {
+        sequential += record.end - record.start;
+    }
+
+    Serial.printf("Boot timeline: %lu ms (%lu ms if run in sequence)\n",
+                  (unsigned long)total, (unsigned long)sequential);
+    for (int stage = 0; stage < STAGE_COUNT; stage++) {
+        const StageRecord &record = records[stage];
+        char bar[BOOT_TIMELINE_WIDTH + 1];
+        int from = total ? (record.start - bootStart) * BOOT_TIMELINE_WIDTH / total : 0;
+        int to = total ? (record.end - bootStart) * BOOT_TIMELINE_WIDTH / total : 0;
+        bool ran = record.end > record.start || record.status != STATUS_SKIPPED;
+        for (int i = 0; i < BOOT_TIMELINE_WIDTH; i++) {
+            bar[i] = (ran && i >= from && (i < to || i == from)) ? '#' : '.';
+        }
+        bar[BOOT_TIMELINE_WIDTH] = '\0';
+        bool over = record.end - record.start > STAGES[stage].budget;
+        Serial.printf("  %-8s %5lu..%5lu ms  %-8s |%s| budget %lu ms%s\n", STAGES[stage].name,
+                      (unsigned long)(record.start - bootStart), (unsigned long)(record.end - bootStart),
+                      statusName(record.status), bar, (unsigned long)STAGES[stage].budget,
+                      over ? ", over" : "");
+    }
+}
+
+BootResult runBoot(bool timerWake) {
+    uint32_t bootStart = millis();
+    wokeByTimer = timerWake;
+    result = { false, config.latitude, config.longitude };
+    for (StageRecord &record : records) {
+        record = { bootStart, bootStart, STATUS_PENDING };
+    }
+
+    // The RTC was already read to decide whether this is a micro-wake
+    if (timerWake) {
+        records[STAGE_TIME].status = STATUS_SKIPPED;
+    }
+
+    // Radio first: association takes longest and needs nothing from the other stages
+    bootTask = xTaskGetCurrentTaskHandle();
+    WiFiEventId_t eventId = WiFi.onEvent(onWiFiEvent);
+    records[STAGE_WIFI].status = STATUS_RUNNING;
+    wifiAttempt = 0;
+    startWiFiAttempt();
+
+    while (true) {
+        pollWiFi();
+
+        int stage = nextStage();
+        if (stage >= 0) {
+            runStage(stage);
+            continue;
+        }
+        if (wifiPhase == WIFI_FINISHED) break;
+
+        // Nothing left to do without the network: sleep until a WiFi event or the deadline
+        int32_t wait = (int32_t)(wifiDeadline - millis());
+        if (wait > 0) ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait));
+    }
+
+    WiFi.removeEvent(eventId);
+    bootTask = nullptr;
+
+    printTimeline(bootStart, millis());
+    return result;
+}
@@ -0,0 +1,45 @@
+#ifndef BOOT_H
+#define BOOT_H
+
+#include <Arduino.h>
+
+// Full-wake orchestration (settings are already loaded). WiFi association is
+// started first; while it is in progress the stages that do not need the
+// network run on the loop task. A stage runs as soon as the stages it depends
+// on have finished, and network stages run as soon as the GOT_IP event
+// arrives. Network stages end on their own timeouts; local stages are plain
+// calls that cannot be cut off, so they run to completion and the timeline
+// printed to serial flags any that went over their BOOT_*_BUDGET_MS.
+
+enum BootStage : uint8_t {
+    STAGE_WIFI,       // Association, WIFI_TIMEOUT_MS per attempt, WIFI_RETRY_ATTEMPTS attempts
+    STAGE_TIME,       // System time from the RTC (done before the micro-wake check on alarm wakes)
+    STAGE_SCREEN,     // Hand the last frame back to the EPD driver, or show the splash
+    STAGE_CHROME,     // Full-screen canvas with the static layer already in it
+    STAGE_NTP,        // Needs WiFi; only if the RTC was never set (NTP_TIMEOUT_MS)
+    STAGE_GEOCODE,    // Needs WiFi; only if no coordinates are stored (HTTP_TIMEOUT_MS per request)
+    STAGE_ASTRO,      // Today's sun and moon events, once the time and location are known
+    STAGE_COUNT
+};
+
+enum StageStatus : uint8_t {
+    STATUS_PENDING,
+    STATUS_RUNNING,
+    STATUS_DONE,
+    STATUS_FAILED,
+    STATUS_TIMEOUT,
+    STATUS_SKIPPED
+};
+
+struct BootResult {
+    bool connected;
+    float latitude;
+    float longitude;
+};
+
+// Run every stage to completion. On timer wakes the RTC has already been read
+// for the micro-wake decision and the last frame is restored instead of
+// showing the splash.
+BootResult runBoot(bool timerWake);
+
+#endif // BOOT_H
@@ -0,0 +1,197 @@
+#include "canvas_backend.h"
+#include "constants.h"
+#include "fixed_trig.h"
+#include "glyphs.h"
+
+// Darken the canvas with a pre-dithered icon, like the glyphs: palette index
+// 0 is black and 15 white, so ink a maps to index 15 - a and white pixels
+// leave whatever is underneath
+static void rasteriseIcon(M5Canvas &target, const IconPayload &icon, int ox, int oy) {
+    const uint8_t *src = iconBitmap(icon.image, icon.depth);
+    if (src == nullptr) return;
+    bool mono = icon.depth == ICON_MONO1;
+    int x = icon.x - ox, y = icon.y - oy;
+    int canvasW = target.width();
+    int canvasH = target.height();
+    uint8_t *buffer = (uint8_t *)target.getBuffer();
+    bool direct = buffer && target.getColorDepth() == 4;
+    int dstStride = (canvasW + 1) / 2;
+
+    for (int row = 0; row < WEATHER_ICON_SIZE; row++) {
+        int py = y + row;
+        if (py < 0 || py >= canvasH) continue;
+        const uint8_t *srcRow = src + row * (mono ? WEATHER_ICON_SIZE / 8 : WEATHER_ICON_SIZE / 2);
+
+        for (int col = 0; col < WEATHER_ICON_SIZE; col++) {
+            int px = x + col;
+            if (px < 0 || px >= canvasW) continue;
+            uint8_t ink = mono ? ((srcRow[col >> 3] >> (7 - (col & 7))) & 1) * 15
+                               : (col & 1) ? (srcRow[col >> 1] & 0x0F) : (srcRow[col >> 1] >> 4);
+            if (ink == 0) continue;
+            uint8_t shade = 15 - ink;
+
+            if (direct) {
+                uint8_t &dst = buffer[py * dstStride + (px >> 1)];
+                uint8_t shift = (px & 1) ? 0 : 4;
+                if (((dst >> shift) & 0x0F) > shade) {
+                    dst = (dst & ~(0x0F << shift)) | (shade << shift);
+                }
+            } else {
+                target.drawPixel(px, py, shade * 0x1111);
+            }
+        }
+    }
+}
+
+static void rasteriseArc(M5Canvas &target, const ArcPayload &arc, int ox, int oy) {
+    // Sector edges as Q14 direction vectors; a point is inside if it lies
+    // clockwise of the start edge and anticlockwise of the end edge
+    int32_t ax = icos10(arc.fromDeg * 10), ay = isin10(arc.fromDeg * 10);
+    int32_t bx = icos10(arc.toDeg * 10), by = isin10(arc.toDeg * 10);
+    bool wide = (arc.toDeg - arc.fromDeg) > 180;
+    int cx = arc.x - ox, cy = arc.y - oy;
+
+    auto plot = [&](int px, int py) {
+        bool afterStart = ax * py - ay * px >= 0;
+        bool beforeEnd = px * by - py * bx >= 0;
+        if (wide ? (afterStart || beforeEnd) : (afterStart && beforeEnd)) {
+            target.drawPixel(cx + px, cy + py, arc.color);
+        }
+    };
+
+    // Midpoint circle, one octant mirrored eight ways
+    int x = arc.r, y = 0, err = 1 - arc.r;
+    while (x >= y) {
+        plot(x, y);   plot(y, x);   plot(-y, x);  plot(-x, y);
+        plot(-x, -y); plot(-y, -x); plot(y, -x);  plot(x, -y);
+        y++;
+        if (err < 0) {
+            err += 2 * y + 1;
+        } else {
+            x--;
+            err += 2 * (y - x) + 1;
+        }
+    }
+}
+
+// Integer Bresenham; spacing > 1 only plots every spacing-th pixel, with the
+// phase carried across segments so dotted polylines stay evenly spaced
+static void plotLine(M5Canvas &target, int x0, int y0, int x1, int y1, int spacing, int &phase, uint32_t color) {
+    int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+
+    while (true) {
+        if (phase == 0) target.drawPixel(x0, y0, color);
+        if (++phase >= spacing) phase = 0;
+        if (x0 == x1 && y0 == y1) break;
+        int e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+}
+
+static void rasterisePolyline(M5Canvas &target, const DrawCommand *cmd, int ox, int oy) {
+    PointsPayload p = DisplayList::payload<PointsPayload>(cmd);
+    const int16_t *pts = DisplayList::payloadPoints(cmd);
+    int phase = 0;
+    for (int i = 1; i < p.count; i++) {
+        int x0 = pts[2 * i - 2] - ox, y0 = pts[2 * i - 1] - oy;
+        int x1 = pts[2 * i] - ox, y1 = pts[2 * i + 1] - oy;
+        if (p.spacing <= 1) {
+            target.drawLine(x0, y0, x1, y1, p.color);
+        } else {
+            plotLine(target, x0, y0, x1, y1, p.spacing, phase, p.color);
+        }
+    }
+}
+
+static void rasterisePolygon(M5Canvas &target, const DrawCommand *cmd, int ox, int oy) {
+    // Convex polygons only: fan out from the first vertex
+    PointsPayload p = DisplayList::payload<PointsPayload>(cmd);
+    const int16_t *pts = DisplayList::payloadPoints(cmd);
+    int x0 = pts[0] - ox, y0 = pts[1] - oy;
+    for (int i = 2; i < p.count; i++) {
+        target.fillTriangle(x0, y0, pts[2 * i - 2] - ox, pts[2 * i - 1] - oy,
+                            pts[2 * i] - ox, pts[2 * i + 1] - oy, p.color);
+    }
+}
+
+void rasteriseDisplayList(const DisplayList &list, M5Canvas &target, int originX, int originY) {
+    const int ox = originX, oy = originY;
+
+    for (const DrawCommand *cmd = list.first(); cmd; cmd = list.next(cmd)) {
+        // Skip commands that cannot touch this canvas
+        const DrawBounds &b = cmd->bounds;
+        if (b.x - ox >= target.width() || b.y - oy >= target.height() ||
+            b.x + b.w - ox <= 0 || b.y + b.h - oy <= 0) {
+            continue;
+        }
+
+        switch (cmd->op) {
+            case OP_TEXT: {
+                TextPayload t = DisplayList::payload<TextPayload>(cmd);
+                target.setTextSize(t.size);
+                target.setTextDatum(t.datum);
+                target.setTextColor(t.color, t.background);
+                target.drawString(DisplayList::payloadText(cmd, sizeof(TextPayload)), t.x - ox, t.y - oy);
+                break;
+            }
+            case OP_LINE: {
+                LinePayload l = DisplayList::payload<LinePayload>(cmd);
+                target.drawLine(l.x0 - ox, l.y0 - oy, l.x1 - ox, l.y1 - oy, l.color);
+                break;
+            }
+            case OP_RECT: {
+                RectPayload r = DisplayList::payload<RectPayload>(cmd);
+                target.drawRect(r.x - ox, r.y - oy, r.w, r.h, r.color);
+                break;
+            }
+            case OP_FILL_RECT: {
+                RectPayload r = DisplayList::payload<RectPayload>(cmd);
+                target.fillRect(r.x - ox, r.y - oy, r.w, r.h, r.color);
+                break;
+            }
+            case OP_CIRCLE: {
+                CirclePayload c = DisplayList::payload<CirclePayload>(cmd);
+                target.drawCircle(c.x - ox, c.y - oy, c.r, c.color);
+                break;
+            }
+            case OP_FILL_CIRCLE: {
+                CirclePayload c = DisplayList::payload<CirclePayload>(cmd);
+                target.fillCircle(c.x - ox, c.y - oy, c.r, c.color);
+                break;
+            }
+            case OP_FILL_TRIANGLE: {
+                TrianglePayload t = DisplayList::payload<TrianglePayload>(cmd);
+                target.fillTriangle(t.x0 - ox, t.y0 - oy, t.x1 - ox, t.y1 - oy, t.x2 - ox, t.y2 - oy, t.color);
+                break;
+            }
+            case OP_PIXEL: {
+                PixelPayload p = DisplayList::payload<PixelPayload>(cmd);
+                target.drawPixel(p.x - ox, p.y - oy, p.color);
+                break;
+            }
+            case OP_ICON:
+                rasteriseIcon(target, DisplayList::payload<IconPayload>(cmd), ox, oy);
+                break;
+            case OP_GLYPHS: {
+                GlyphsPayload g = DisplayList::payload<GlyphsPayload>(cmd);
+                blitGlyphText(target, *(const GlyphFont *)g.font,
+                              DisplayList::payloadText(cmd, sizeof(GlyphsPayload)), g.x - ox, g.y - oy);
+                break;
+            }
+            case OP_ARC:
+                rasteriseArc(target, DisplayList::payload<ArcPayload>(cmd), ox, oy);
+                break;
+            case OP_FILL_POLYGON:
+                rasterisePolygon(target, cmd, ox, oy);
+                break;
+            case OP_POLYLINE:
+                rasterisePolyline(target, cmd, ox, oy);
+                break;
+            default:
+                break;
+        }
+    }
+}
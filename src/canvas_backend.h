@@ -0,0 +1,12 @@
+#ifndef CANVAS_BACKEND_H
+#define CANVAS_BACKEND_H
+
+#include <M5Unified.h>
+#include "displaylist.h"
+
+// Rasterise a recorded display list into a canvas. Commands are in screen
+// coordinates; (originX, originY) is the screen position of the canvas'
+// top-left corner, so panel-sized sprites can replay the same commands.
+void rasteriseDisplayList(const DisplayList &list, M5Canvas &target, int originX = 0, int originY = 0);
+
+#endif // CANVAS_BACKEND_H
@@ -0,0 +1,117 @@
+#include "chromecache.h"
+#include "constants.h"
+#include "config.h"
+#include "asset_store.h"
+#include <M5Unified.h>
+#include <esp_partition.h>
+#include <esp_ota_ops.h>
+#include <esp_rom_crc.h>
+
+extern M5Canvas canvas;
+
+#define CHROME_MAGIC 0x43484D31  // "CHM1"
+#define CHROME_ROW_BYTES (SCREEN_WIDTH / 2)
+#define CHROME_IMAGE_SIZE (CHROME_ROW_BYTES * SCREEN_HEIGHT)
+#define CHROME_IMAGE_OFFSET 16
+
+struct ChromeHeader {
+    uint32_t magic;
+    uint32_t key;
+    uint32_t size;
+    uint32_t reserved;
+};
+static_assert(sizeof(ChromeHeader) <= CHROME_IMAGE_OFFSET, "chrome header too large");
+
+static const esp_partition_t *chromePartition = nullptr;
+
+static bool openPartition() {
+    if (chromePartition == nullptr) {
+        chromePartition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                                   (esp_partition_subtype_t)CHROME_PARTITION_SUBTYPE,
+                                                   CHROME_PARTITION_LABEL);
+        if (chromePartition == nullptr) {
+            Serial.println("Chrome cache partition not found");
+            return false;
+        }
+        if (chromePartition->size < CHROME_IMAGE_OFFSET + CHROME_IMAGE_SIZE) {
+            Serial.println("Chrome cache partition too small");
+            chromePartition = nullptr;
+            return false;
+        }
+    }
+    return true;
+}
+
+// Anything that changes the static layer must change this key
+static uint32_t chromeKey() {
+    const esp_app_desc_t *app = esp_ota_get_app_description();
+    uint32_t key = esp_rom_crc32_le(0, app->app_elf_sha256, sizeof(app->app_elf_sha256));
+    uint8_t settings[2] = { LAYOUT_VERSION, config.useCelsius };
+    key = esp_rom_crc32_le(key, settings, sizeof(settings));
+    uint32_t assets = assetStoreKey();
+    return esp_rom_crc32_le(key, (const uint8_t *)&assets, sizeof(assets));
+}
+
+static bool canvasMatches() {
+    return canvas.getBuffer() != nullptr && canvas.bufferLength() == CHROME_IMAGE_SIZE;
+}
+
+static bool headerValid() {
+    ChromeHeader header;
+    return esp_partition_read(chromePartition, 0, &header, sizeof(header)) == ESP_OK &&
+           header.magic == CHROME_MAGIC && header.key == chromeKey() && header.size == CHROME_IMAGE_SIZE;
+}
+
+bool chromeLayerValid() {
+    if (!openPartition()) return false;
+    if (!headerValid()) {
+        Serial.println("Chrome cache stale, re-rendering static layer");
+        return false;
+    }
+    return true;
+}
+
+bool loadChromeRows(uint8_t *dst, int y, int rows) {
+    if (!openPartition()) return false;
+    return esp_partition_read(chromePartition, CHROME_IMAGE_OFFSET + y * CHROME_ROW_BYTES,
+                              dst, rows * CHROME_ROW_BYTES) == ESP_OK;
+}
+
+bool loadChromeLayer() {
+    if (!canvasMatches() || !chromeLayerValid()) return false;
+
+    const void *mapped = nullptr;
+    spi_flash_mmap_handle_t handle;
+    if (esp_partition_mmap(chromePartition, 0, CHROME_IMAGE_OFFSET + CHROME_IMAGE_SIZE,
+                           SPI_FLASH_MMAP_DATA, &mapped, &handle) != ESP_OK) {
+        return false;
+    }
+
+    unsigned long start = micros();
+    memcpy(canvas.getBuffer(), (const uint8_t *)mapped + CHROME_IMAGE_OFFSET, CHROME_IMAGE_SIZE);
+    spi_flash_munmap(handle);
+
+    Serial.printf("Chrome layer loaded in %lu us\n", micros() - start);
+    return true;
+}
+
+void saveChromeLayer() {
+    if (!openPartition() || !canvasMatches()) return;
+
+    unsigned long start = millis();
+    ChromeHeader header = {};
+    header.magic = CHROME_MAGIC;
+    header.key = chromeKey();
+    header.size = CHROME_IMAGE_SIZE;
+
+    // Header last, so an interrupted write leaves the cache invalid rather than torn
+    bool ok = esp_partition_erase_range(chromePartition, 0, chromePartition->size) == ESP_OK &&
+              esp_partition_write(chromePartition, CHROME_IMAGE_OFFSET, canvas.getBuffer(), CHROME_IMAGE_SIZE) == ESP_OK &&
+              esp_partition_write(chromePartition, 0, &header, sizeof(header)) == ESP_OK;
+
+    if (ok) {
+        Serial.printf("Chrome layer cached in %lu ms\n", millis() - start);
+    } else {
+        Serial.println("Chrome cache write failed");
+    }
+}
@@ -0,0 +1,22 @@
+#ifndef CHROMECACHE_H
+#define CHROMECACHE_H
+
+#include <Arduino.h>
+
+// Pre-rendered static layer of the dashboard, kept as a packed 4bpp image in the
+// "chrome" flash partition. Keyed on firmware build, layout version, units and
+// the asset partition.
+
+// Copy the cached layer into the full-screen canvas with one memcpy.
+// Returns false if the cache is missing or stale.
+bool loadChromeLayer();
+
+// Banded rendering: check the cache once, then copy rows [y, y + rows) into a
+// packed 4bpp buffer of SCREEN_WIDTH pixels per row
+bool chromeLayerValid();
+bool loadChromeRows(uint8_t *dst, int y, int rows);
+
+// Store the canvas (which must hold only the static layer) as the new cache
+void saveChromeLayer();
+
+#endif // CHROMECACHE_H
@@ -0,0 +1,206 @@
+#include "clock_sync.h"
+#include "constants.h"
+#include "utils.h"
+#include <M5Unified.h>
+#include <WiFi.h>
+#include <WiFiUdp.h>
+#include <Preferences.h>
+#include <sys/time.h>
+#include <math.h>
+#include <stdlib.h>
+
+extern Preferences preferences;
+
+#define SNTP_PACKET_SIZE 48
+#define NTP_UNIX_OFFSET 2208988800UL   // 1900-01-01 to 1970-01-01
+
+// Stored under CLOCK_SYNC_KEY
+struct ClockState {
+    uint32_t anchor;        // UTC the RTC was last set to from a server; 0 if never
+    int32_t driftPpb;       // RTC rate error: positive when it runs slow
+    uint8_t samples;        // Measurements folded into driftPpb
+    uint32_t ntpAddress;    // Resolved NTP_SERVER_1, 0 to resolve again
+};
+
+static ClockState state;
+static bool loaded = false;
+static bool rtcRead = false;    // System time came from the RTC this wake
+static bool verified = false;   // A server time was seen this wake
+
+static void loadState() {
+    if (loaded) return;
+    preferences.begin("weather", true);
+    if (preferences.getBytes(CLOCK_SYNC_KEY, &state, sizeof(state)) != sizeof(state)) {
+        memset(&state, 0, sizeof(state));
+    }
+    preferences.end();
+    loaded = true;
+}
+
+static void saveState() {
+    preferences.begin("weather", false);
+    preferences.putBytes(CLOCK_SYNC_KEY, &state, sizeof(state));
+    preferences.end();
+}
+
+static int64_t nowMicros() {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+time_t correctRtcTime(time_t rtc) {
+    loadState();
+    rtcRead = true;
+    if (state.anchor == 0 || rtc <= (time_t)state.anchor) return rtc;
+    return rtc + (int64_t)(rtc - state.anchor) * state.driftPpb / 1000000000;
+}
+
+int rtcAlarmSeconds(int seconds) {
+    loadState();
+    // A slow RTC counts fewer seconds than really pass
+    int adjusted = seconds - (int64_t)seconds * state.driftPpb / 1000000000;
+    return adjusted > 0 ? adjusted : 1;
+}
+
+// Fold the error since the last sync into the drift estimate, then step the
+// system clock and the RTC to the server time
+static void adoptServerTime(int64_t serverMicros) {
+    loadState();
+    int64_t localMicros = nowMicros();
+
+    // The RTC's own count is only known if this wake's time came from it
+    int64_t anchorMicros = (int64_t)state.anchor * 1000000;
+    if (state.anchor != 0 && rtcRead && localMicros - anchorMicros >= (int64_t)CLOCK_DRIFT_BASELINE_S * 1000000) {
+        // Undo the correction already applied to get the RTC's raw count
+        double rtcElapsed = (localMicros - anchorMicros) / (1.0 + state.driftPpb * 1e-9);
+        double measured = ((serverMicros - anchorMicros) / rtcElapsed - 1.0) * 1e9;
+        if (fabs(measured) <= CLOCK_MAX_DRIFT_PPB) {
+            // Each estimate spans a day or more, so the latest counts for half
+            state.driftPpb = state.samples ? (state.driftPpb + (int32_t)measured) / 2 : (int32_t)measured;
+            if (state.samples < UINT8_MAX) state.samples++;
+        } else {
+            Serial.printf("Ignoring RTC drift of %ld ppb\n", (long)measured);
+        }
+    }
+
+    struct timeval tv = { .tv_sec = (time_t)(serverMicros / 1000000), .tv_usec = (suseconds_t)(serverMicros % 1000000) };
+    settimeofday(&tv, nullptr);
+
+    // The RTC has whole seconds
+    time_t rounded = (serverMicros + 500000) / 1000000;
+    struct tm utc;
+    gmtime_r(&rounded, &utc);
+    M5.Rtc.setDateTime(utc);
+
+    state.anchor = rounded;
+    saveState();
+    verified = true;
+    Serial.printf("Clock stepped by %ld ms, RTC drift %ld ppb (%u samples)\n",
+                  (long)((serverMicros - localMicros) / 1000), (long)state.driftPpb, (unsigned)state.samples);
+}
+
+void observeServerTime(time_t utc) {
+    loadState();
+    verified = true;
+
+    // The header truncates to the second
+    int64_t serverMicros = (int64_t)utc * 1000000 + 500000;
+    int64_t error = serverMicros - nowMicros();
+    bool baselineReached = state.anchor == 0 || utc - (time_t)state.anchor >= CLOCK_DRIFT_BASELINE_S;
+    if (!baselineReached && llabs(error) <= (int64_t)CLOCK_MAX_ERROR_S * 1000000) {
+        Serial.printf("Clock within %ld ms of the server\n", (long)(error / 1000));
+        return;
+    }
+    adoptServerTime(serverMicros);
+}
+
+void clockSynced(time_t utc, int32_t micros) {
+    adoptServerTime((int64_t)utc * 1000000 + micros);
+}
+
+bool clockResyncDue() {
+    if (verified) return false;
+    time_t now = time(nullptr);
+    if (now < MIN_VALID_EPOCH) return false;  // The NTP boot stage sets the clock from scratch
+
+    loadState();
+    if (state.anchor == 0) return true;
+    int64_t uncertaintyPpb = state.samples ? CLOCK_RESIDUAL_DRIFT_PPB : CLOCK_UNKNOWN_DRIFT_PPB;
+    int64_t predictedMicros = (int64_t)(now - state.anchor) * uncertaintyPpb / 1000;
+    return predictedMicros > (int64_t)CLOCK_MAX_ERROR_S * 1000000;
+}
+
+static uint32_t readBigEndian(const uint8_t *bytes) {
+    return (uint32_t)bytes[0] << 24 | (uint32_t)bytes[1] << 16 | (uint32_t)bytes[2] << 8 | bytes[3];
+}
+
+bool sntpResync() {
+    loadState();
+    IPAddress server(state.ntpAddress);
+    if (state.ntpAddress == 0) {
+        if (!WiFi.hostByName(NTP_SERVER_1, server)) {
+            Serial.println("NTP server lookup failed");
+            return false;
+        }
+        state.ntpAddress = (uint32_t)server;
+    }
+
+    // Client request: leap indicator 0, version 4, mode 3
+    uint8_t packet[SNTP_PACKET_SIZE] = { 0x23 };
+    WiFiUDP udp;
+    udp.begin(SNTP_LOCAL_PORT);
+    uint32_t sentAt = millis();
+    udp.beginPacket(server, SNTP_PORT);
+    udp.write(packet, sizeof(packet));
+    udp.endPacket();
+
+    bool received = false;
+    while (millis() - sentAt < SNTP_TIMEOUT_MS) {
+        if (udp.parsePacket() >= SNTP_PACKET_SIZE) {
+            received = udp.read(packet, sizeof(packet)) == SNTP_PACKET_SIZE;
+            break;
+        }
+        delay(5);
+    }
+    uint32_t roundTrip = millis() - sentAt;
+    udp.stop();
+
+    // Server mode with a non-zero stratum; anything else is a kiss-o'-death or junk
+    if (!received || (packet[0] & 0x07) != 4 || packet[1] == 0) {
+        Serial.println("SNTP request failed");
+        state.ntpAddress = 0;  // The pool may have moved on; resolve again next time
+        saveState();
+        return false;
+    }
+
+    // Transmit timestamp, plus half the round trip it took to get here
+    uint32_t seconds = readBigEndian(packet + 40);
+    uint32_t fraction = readBigEndian(packet + 44);
+    int64_t serverMicros = (int64_t)(seconds - NTP_UNIX_OFFSET) * 1000000 +
+                           (((uint64_t)fraction * 1000000) >> 32) + roundTrip * 500;
+    Serial.printf("SNTP reply from %s in %lu ms\n", server.toString().c_str(), (unsigned long)roundTrip);
+    adoptServerTime(serverMicros);
+    return true;
+}
+
+bool parseHttpDate(const char *text, time_t &utc) {
+    static const char MONTHS[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+    int day, year, hour, minute, second;
+    char month[4];
+    if (!text || sscanf(text, "%*[^,], %d %3s %d %d:%d:%d", &day, month, &year, &hour, &minute, &second) != 6) {
+        return false;
+    }
+    const char *found = strstr(MONTHS, month);
+    if (!found || strlen(month) != 3 || (found - MONTHS) % 3 != 0) return false;
+
+    struct tm tm = {};
+    tm.tm_year = year - 1900;
+    tm.tm_mon = (found - MONTHS) / 3;
+    tm.tm_mday = day;
+    tm.tm_hour = hour;
+    tm.tm_min = minute;
+    tm.tm_sec = second;
+    utc = wallSeconds(tm);
+    return utc >= MIN_VALID_EPOCH;
+}
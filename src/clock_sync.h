@@ -0,0 +1,37 @@
+#ifndef CLOCK_SYNC_H
+#define CLOCK_SYNC_H
+
+#include <stdint.h>
+#include <time.h>
+
+// RTC drift compensation. Every server time the device sees (the Date header
+// of the forecast download, or a single SNTP packet) is compared with the
+// RTC; over a day or more that gives the crystal's rate error, which is then
+// applied to RTC reads and alarm intervals. The clock is only stepped, and
+// SNTP only asked, when the predicted error exceeds CLOCK_MAX_ERROR_S.
+
+// UTC from a raw RTC reading, corrected for the drift since the last sync
+time_t correctRtcTime(time_t rtc);
+
+// RTC alarm interval that elapses after the given number of real seconds
+int rtcAlarmSeconds(int seconds);
+
+// Server time with whole-second resolution, taken at the moment of the call.
+// Steps the clock if it is off by more than CLOCK_MAX_ERROR_S, and updates the
+// drift estimate once the last sync is far enough back.
+void observeServerTime(time_t utc);
+
+// Precise server time (SNTP); always steps the clock and writes the RTC
+void clockSynced(time_t utc, int32_t micros);
+
+// No server time was seen this wake and the RTC error may exceed the limit
+bool clockResyncDue();
+
+// One SNTP request to the cached server address (resolved on first use).
+// Needs WiFi; returns false on timeout.
+bool sntpResync();
+
+// "Sun, 18 Oct 2026 05:06:40 GMT" (RFC 7231 IMF-fixdate)
+bool parseHttpDate(const char *text, time_t &utc);
+
+#endif // CLOCK_SYNC_H
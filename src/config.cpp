@@ -1,60 +1,180 @@
 #include "config.h"
 #include "constants.h"
 #include "weather_api.h"
+#include "weather_codes.h"
 #include <M5Unified.h>
 #include <WiFi.h>
 #include <Preferences.h>
 #include <WebServer.h>
+#include <esp_rom_crc.h>
 
 extern Preferences preferences;
-extern bool useCelsius;
-extern bool nightModeSleep;
-extern String cityName;
+extern bool frameRestored;
+
+bool rtcHoldsLocalTime = false;
+
+// ---- Settings blob ----
+
+struct ConfigBlob {
+    uint16_t version;
+    uint16_t size;              // Bytes of Config that follow
+    uint32_t crc;
+    Config config;
+};
+
+#define CONFIG_HEADER_SIZE offsetof(ConfigBlob, config)
+
+static void setDefaults(Config &c) {
+    memset(&c, 0, sizeof(c));
+    strlcpy(c.city, DEFAULT_CITY, sizeof(c.city));
+    c.latitude = COORD_NOT_SET;
+    c.longitude = COORD_NOT_SET;
+    c.useCelsius = false;
+    c.nightMode = true;
+    c.dayInterval = REFRESH_INTERVAL_DAY_MS / 60000;
+    c.nightInterval = REFRESH_INTERVAL_NIGHT_MS / 60000;
+    c.nightStart = NIGHT_START_HOUR;
+    c.nightEnd = NIGHT_END_HOUR;
+    c.language = LANG_EN;
+    strlcpy(c.timezone, DEFAULT_TIMEZONE, sizeof(c.timezone));
+}
 
-void setupWiFi() {
-    preferences.begin("weather", false);
-    String ssid = preferences.getString("ssid", "");
-    String password = preferences.getString("password", "");
-    preferences.end();
+// Limits shared by the portal and loadConfig()
+static bool dayIntervalValid(int minutes) {
+    return minutes >= DAY_INTERVAL_MIN && minutes <= DAY_INTERVAL_MAX;
+}
 
-    if (ssid.length() > 0) {
-        WiFi.mode(WIFI_STA);
+static bool nightIntervalValid(int minutes) {
+    return minutes >= NIGHT_INTERVAL_MIN && minutes <= NIGHT_INTERVAL_MAX;
+}
 
-        for (int attempt = 0; attempt < WIFI_RETRY_ATTEMPTS; attempt++) {
-            if (attempt > 0) {
-                Serial.printf("WiFi retry %d/%d...\n", attempt + 1, WIFI_RETRY_ATTEMPTS);
-                delay(WIFI_RETRY_DELAY_MS);
-            }
+static bool hourValid(int hour) {
+    return hour >= 0 && hour <= 23;
+}
 
-            WiFi.begin(ssid.c_str(), password.c_str());
+// Settings as written key by key before the blob existed
+static const char *const LEGACY_KEYS[] = {
+    "ssid", "password", "city", "latitude", "longitude", "tempunit",
+    "nightmode", "day_interval", "night_interval", "night_start", "night_end",
+};
 
-            unsigned long start = millis();
-            while (WiFi.status() != WL_CONNECTED && millis() - start < WIFI_TIMEOUT_MS) {
-                delay(500);
-                Serial.print(".");
-            }
+// The namespace must be open
+static bool hasLegacyKeys() {
+    return preferences.isKey("ssid") || preferences.isKey("city");
+}
 
-            if (WiFi.status() == WL_CONNECTED) {
-                Serial.println("\nWiFi connected!");
-                Serial.println(WiFi.localIP());
-                return;
-            }
+static bool loadLegacyKeys(Config &c) {
+    if (!hasLegacyKeys()) return false;
+
+    strlcpy(c.ssid, preferences.getString("ssid", "").c_str(), sizeof(c.ssid));
+    strlcpy(c.password, preferences.getString("password", "").c_str(), sizeof(c.password));
+    strlcpy(c.city, preferences.getString("city", DEFAULT_CITY).c_str(), sizeof(c.city));
+    c.latitude = preferences.getString("latitude", String(COORD_NOT_SET)).toFloat();
+    c.longitude = preferences.getString("longitude", String(COORD_NOT_SET)).toFloat();
+    c.useCelsius = preferences.getString("tempunit", "F") == "C";
+    c.nightMode = preferences.getBool("nightmode", c.nightMode);
+    c.dayInterval = preferences.getInt("day_interval", c.dayInterval);
+    c.nightInterval = preferences.getInt("night_interval", c.nightInterval);
+    c.nightStart = preferences.getInt("night_start", c.nightStart);
+    c.nightEnd = preferences.getInt("night_end", c.nightEnd);
+    return true;
+}
 
-            Serial.println("\nWiFi connection failed");
-            WiFi.disconnect();
+void loadConfig() {
+    ConfigBlob blob;
+    setDefaults(config);
+
+    preferences.begin("weather", true);
+    size_t length = preferences.getBytes(CONFIG_BLOB_KEY, &blob, sizeof(blob));
+    bool valid = length >= CONFIG_HEADER_SIZE && blob.version <= CONFIG_VERSION &&
+                 blob.size == length - CONFIG_HEADER_SIZE &&
+                 blob.crc == esp_rom_crc32_le(0, (const uint8_t *)&blob.config, blob.size);
+    bool migrated = !valid && loadLegacyKeys(config);
+    // Firmware that migrated without removing them left them next to the blob
+    bool stale = valid && hasLegacyKeys();
+    preferences.end();
+
+    if (valid) {
+        // Older versions are a prefix of the current struct
+        memcpy(&config, &blob.config, blob.size);
+        if (blob.version < 3) {
+            // The time zone overlaps the old struct's tail padding
+            strlcpy(config.timezone, DEFAULT_TIMEZONE, sizeof(config.timezone));
+        }
+        // Only convert the RTC once the version that says it holds UTC is stored
+        if ((blob.version < CONFIG_VERSION || stale) && saveConfig() && blob.version < 3) {
+            rtcHoldsLocalTime = true;
+        }
+    } else if (migrated) {
+        // The keys go with this save, so the RTC is only converted once
+        if (saveConfig()) {
+            Serial.println("Settings migrated from individual keys");
+            rtcHoldsLocalTime = true;
         }
+    } else {
+        Serial.println("No stored settings, using defaults");
+    }
+
+    // The CRC only proves the bytes are what was written, so hold them to the
+    // same limits as the portal
+    Config defaults;
+    setDefaults(defaults);
+    config.ssid[sizeof(config.ssid) - 1] = '\0';
+    config.password[sizeof(config.password) - 1] = '\0';
+    config.city[sizeof(config.city) - 1] = '\0';
+    if (!dayIntervalValid(config.dayInterval)) config.dayInterval = defaults.dayInterval;
+    if (!nightIntervalValid(config.nightInterval)) config.nightInterval = defaults.nightInterval;
+    if (!hourValid(config.nightStart)) config.nightStart = defaults.nightStart;
+    if (!hourValid(config.nightEnd)) config.nightEnd = defaults.nightEnd;
+    // Indexes the text tables, so never trust it
+    if (config.language >= LANG_COUNT) config.language = LANG_EN;
+    config.timezone[sizeof(config.timezone) - 1] = '\0';
+    if (config.timezone[0] == '\0') strlcpy(config.timezone, DEFAULT_TIMEZONE, sizeof(config.timezone));
+}
 
-        Serial.println("All WiFi connection attempts failed");
+bool saveConfig() {
+    ConfigBlob blob;
+    memset(&blob, 0, sizeof(blob));
+    blob.version = CONFIG_VERSION;
+    blob.size = sizeof(Config);
+    blob.config = config;
+    blob.crc = esp_rom_crc32_le(0, (const uint8_t *)&blob.config, sizeof(Config));
+
+    preferences.begin("weather", false);
+    bool ok = preferences.putBytes(CONFIG_BLOB_KEY, &blob, sizeof(blob)) == sizeof(blob);
+    if (ok) {
+        // Left behind, they would come back whenever the blob is unreadable
+        for (const char *key : LEGACY_KEYS) {
+            if (preferences.isKey(key)) preferences.remove(key);
+        }
     }
+    preferences.end();
+
+    if (!ok) Serial.println("Settings write failed");
+    return ok;
+}
+
+bool hasCoordinates() {
+    return config.latitude != COORD_NOT_SET && config.longitude != COORD_NOT_SET;
+}
+
+// ---- WiFi ----
 
-    // No saved credentials or all attempts failed
-    startConfigPortal();
+bool beginWiFi() {
+    if (config.ssid[0] == '\0') return false;
+
+    WiFi.mode(WIFI_STA);
+    WiFi.begin(config.ssid, config.password);
+    return true;
 }
 
 void startConfigPortal() {
     WiFi.mode(WIFI_AP);
     WiFi.softAP(CONFIG_AP_SSID, CONFIG_AP_PASSWORD);
 
+    // The portal screen replaces whatever the restored snapshot said was on the glass
+    frameRestored = false;
+
     M5.Display.startWrite();
     M5.Display.fillScreen(TFT_WHITE);
     M5.Display.setTextColor(TFT_BLACK);
@@ -69,20 +189,19 @@ void startConfigPortal() {
     WebServer server(80);
 
     server.on("/", HTTP_GET, [&server]() {
-        // Load current settings including WiFi credentials
-        preferences.begin("weather", true);
-        String currentSSID = preferences.getString("ssid", "");
-        String currentPassword = preferences.getString("password", "");
-        String currentCity = preferences.getString("city", DEFAULT_CITY);
-        String currentLat = preferences.getString("latitude", "");
-        String currentLon = preferences.getString("longitude", "");
-        String currentUnit = preferences.getString("tempunit", "F");
-        bool currentNightMode = preferences.getBool("nightmode", true);
-        int currentDayInterval = preferences.getInt("day_interval", 10);
-        int currentNightInterval = preferences.getInt("night_interval", 60);
-        int currentNightStart = preferences.getInt("night_start", 22);
-        int currentNightEnd = preferences.getInt("night_end", 5);
-        preferences.end();
+        // Current settings including WiFi credentials
+        String currentSSID = config.ssid;
+        String currentPassword = config.password;
+        String currentCity = config.city;
+        String currentLat = hasCoordinates() ? String(config.latitude, 4) : String();
+        String currentLon = hasCoordinates() ? String(config.longitude, 4) : String();
+        String currentUnit = config.useCelsius ? "C" : "F";
+        bool currentNightMode = config.nightMode;
+        int currentDayInterval = config.dayInterval;
+        int currentNightInterval = config.nightInterval;
+        int currentNightStart = config.nightStart;
+        int currentNightEnd = config.nightEnd;
+        int currentLanguage = config.language;
 
         String html = "<!DOCTYPE html><html><head>";
         html += "<meta charset='UTF-8'>";
@@ -181,6 +300,13 @@ void startConfigPortal() {
         html += "<option value='F'" + String(currentUnit == "F" ? " selected" : "") + ">Fahrenheit</option>";
         html += "<option value='C'" + String(currentUnit == "C" ? " selected" : "") + ">Celsius</option>";
         html += "</select>";
+        html += "<label>Language:</label>";
+        html += "<select name='language'>";
+        for (int lang = 0; lang < LANG_COUNT; lang++) {
+            html += "<option value='" + String(lang) + "'" + String(lang == currentLanguage ? " selected" : "") + ">" +
+                    LANGUAGE_NAMES[lang] + "</option>";
+        }
+        html += "</select>";
         html += "</div>";
 
         // Update Schedule
@@ -227,6 +353,7 @@ void startConfigPortal() {
         int nightInterval = server.arg("night_interval").toInt();
         int nightStart = server.arg("night_start").toInt();
         int nightEnd = server.arg("night_end").toInt();
+        int language = server.arg("language").toInt();
 
         if (ssid.length() == 0 || city.length() == 0) {
             server.send(400, "text/html",
@@ -235,15 +362,23 @@ void startConfigPortal() {
             return;
         }
 
+        if (ssid.length() >= sizeof(config.ssid) || password.length() >= sizeof(config.password) ||
+            city.length() >= sizeof(config.city)) {
+            server.send(400, "text/html",
+                "<html><body><h1>Error</h1><p>SSID, password or city name is too long!</p>"
+                "<a href='/'>Go Back</a></body></html>");
+            return;
+        }
+
         // Validate refresh intervals
-        if (dayInterval < 5 || dayInterval > 120) {
+        if (!dayIntervalValid(dayInterval)) {
             server.send(400, "text/html",
                 "<html><body><h1>Error</h1><p>Day refresh interval must be 5-120 minutes!</p>"
                 "<a href='/'>Go Back</a></body></html>");
             return;
         }
 
-        if (nightInterval < 15 || nightInterval > 240) {
+        if (!nightIntervalValid(nightInterval)) {
             server.send(400, "text/html",
                 "<html><body><h1>Error</h1><p>Night refresh interval must be 15-240 minutes!</p>"
                 "<a href='/'>Go Back</a></body></html>");
@@ -251,7 +386,7 @@ void startConfigPortal() {
         }
 
         // Validate night mode hours
-        if (nightStart < 0 || nightStart > 23 || nightEnd < 0 || nightEnd > 23) {
+        if (!hourValid(nightStart) || !hourValid(nightEnd)) {
             server.send(400, "text/html",
                 "<html><body><h1>Error</h1><p>Night hours must be 0-23!</p>"
                 "<a href='/'>Go Back</a></body></html>");
@@ -270,28 +405,33 @@ void startConfigPortal() {
             }
         }
 
-        // Save preferences
-        preferences.begin("weather", false);
-        preferences.putString("ssid", ssid);
-        preferences.putString("password", password);
-        preferences.putString("city", city);
-        preferences.putString("tempunit", tempUnit);
-        preferences.putBool("nightmode", nightMode);
-        preferences.putInt("day_interval", dayInterval);
-        preferences.putInt("night_interval", nightInterval);
-        preferences.putInt("night_start", nightStart);
-        preferences.putInt("night_end", nightEnd);
+        // Save settings
+        strlcpy(config.ssid, ssid.c_str(), sizeof(config.ssid));
+        strlcpy(config.password, password.c_str(), sizeof(config.password));
+        strlcpy(config.city, city.c_str(), sizeof(config.city));
+        config.useCelsius = tempUnit == "C";
+        config.nightMode = nightMode;
+        config.dayInterval = dayInterval;
+        config.nightInterval = nightInterval;
+        config.nightStart = nightStart;
+        config.nightEnd = nightEnd;
+        config.language = language >= 0 && language < LANG_COUNT ? language : LANG_EN;
 
         if (lat.length() > 0 && lon.length() > 0) {
-            preferences.putString("latitude", lat);
-            preferences.putString("longitude", lon);
+            config.latitude = lat.toFloat();
+            config.longitude = lon.toFloat();
         } else {
             // Clear coordinates so they'll be geocoded
-            preferences.putString("latitude", String(COORD_NOT_SET));
-            preferences.putString("longitude", String(COORD_NOT_SET));
+            config.latitude = COORD_NOT_SET;
+            config.longitude = COORD_NOT_SET;
         }
 
-        preferences.end();
+        if (!saveConfig()) {
+            server.send(500, "text/html",
+                "<html><body><h1>Error</h1><p>Settings could not be saved!</p>"
+                "<a href='/'>Go Back</a></body></html>");
+            return;
+        }
 
         server.send(200, "text/html",
             "<html><head><meta http-equiv='refresh' content='3;url=/restart'></head>"
@@ -315,34 +455,17 @@ void startConfigPortal() {
     WiFi.mode(WIFI_STA);
 }
 
-void loadPreferences(float &latitude, float &longitude, String &cityName) {
-    preferences.begin("weather", true);
-    String latStr = preferences.getString("latitude", String(COORD_NOT_SET));
-    String lonStr = preferences.getString("longitude", String(COORD_NOT_SET));
-    cityName = preferences.getString("city", DEFAULT_CITY);
-    String tempUnit = preferences.getString("tempunit", "F");
-    useCelsius = (tempUnit == "C");
-    nightModeSleep = preferences.getBool("nightmode", true);
-    preferences.end();
-
-    latitude = latStr.toFloat();
-    longitude = lonStr.toFloat();
-
-    if (latitude == COORD_NOT_SET || longitude == COORD_NOT_SET) {
-        Serial.println("No coordinates found, geocoding city: " + cityName);
-        if (geocodeCity(cityName, latitude, longitude)) {
-            preferences.begin("weather", false);
-            preferences.putString("latitude", String(latitude, 4));
-            preferences.putString("longitude", String(longitude, 4));
-            preferences.end();
-            Serial.printf("Geocoded %s to %.4f, %.4f\n", cityName.c_str(), latitude, longitude);
-        } else {
-            Serial.println("Geocoding failed, using defaults");
-            latitude = DEFAULT_LATITUDE;
-            longitude = DEFAULT_LONGITUDE;
-        }
+bool resolveCoordinates(float &latitude, float &longitude) {
+    if (geocodeCity(config.city, latitude, longitude)) {
+        config.latitude = latitude;
+        config.longitude = longitude;
+        saveConfig();
+        Serial.printf("Geocoded %s to %.4f, %.4f\n", config.city, latitude, longitude);
+        return true;
     }
 
-    Serial.printf("Using coordinates: %.4f, %.4f (%s)\n", latitude, longitude, cityName.c_str());
-    Serial.printf("Temperature unit: %s\n", useCelsius ? "Celsius" : "Fahrenheit");
+    Serial.println("Geocoding failed, using defaults");
+    latitude = DEFAULT_LATITUDE;
+    longitude = DEFAULT_LONGITUDE;
+    return false;
 }
@@ -2,14 +2,53 @@
 #define CONFIG_H
 
 #include <Arduino.h>
+#include "timezone.h"
 
-// WiFi setup with retry logic
-void setupWiFi();
+// Everything the configuration portal sets. Stored as one CRC-checked blob
+// (CONFIG_BLOB_KEY in the "weather" namespace) behind a version/size header.
+// Fields are only ever appended, so an older, shorter blob is a valid prefix
+// and the new fields keep their defaults.
+struct Config {
+    char ssid[33];
+    char password[65];
+    char city[64];
+    float latitude;             // COORD_NOT_SET until the city is geocoded
+    float longitude;
+    bool useCelsius;
+    bool nightMode;             // Longer refresh interval during night hours
+    uint8_t dayInterval;        // Refresh interval in minutes
+    uint8_t nightInterval;
+    uint8_t nightStart;         // Night hours, 0-23
+    uint8_t nightEnd;
+    uint8_t language;           // Language (weather_codes.h) of the condition texts
+    char timezone[TIMEZONE_RULE_SIZE];  // POSIX TZ rule, learnt from the forecast
+};
+
+// Loaded once per wake by loadConfig()
+extern Config config;
+
+// Set by loadConfig() when the settings predate the UTC clock: the RTC still
+// holds local wall time and setupTime() converts it once
+extern bool rtcHoldsLocalTime;
+
+// Read the settings blob. Falls back to the per-key settings written by older
+// firmware (and stores them as a blob), or to defaults if there are neither.
+void loadConfig();
+
+// Write the whole struct with a single NVS operation
+bool saveConfig();
+
+bool hasCoordinates();
+
+// Start associating with the saved network and return immediately; false if
+// no credentials are stored. Completion is reported through WiFi events.
+bool beginWiFi();
 
 // Configuration portal
 void startConfigPortal();
 
-// Load preferences
-void loadPreferences(float &latitude, float &longitude, String &cityName);
+// Geocode the configured city (needs WiFi) and store the result; on failure
+// the default coordinates are returned and false is returned
+bool resolveCoordinates(float &latitude, float &longitude);
 
 #endif // CONFIG_H
@@ -8,30 +8,76 @@
 #define WIFI_TIMEOUT_MS 20000
 #define WIFI_RETRY_ATTEMPTS 3
 #define WIFI_RETRY_DELAY_MS 2000
+#define BOOT_TIMELINE_WIDTH 40             // Columns in the serial boot timeline chart
+#define BOOT_TIME_BUDGET_MS 100             // Expected worst case of the local boot stages,
+#define BOOT_SCREEN_BUDGET_MS 2000          // reported in the timeline (boot.h)
+#define BOOT_CHROME_BUDGET_MS 500
+#define BOOT_ASTRO_BUDGET_MS 100
 
 // API Configuration
 #define HTTP_TIMEOUT_MS 10000
 #define HTTP_RETRY_ATTEMPTS 3
 #define HTTP_RETRY_DELAY_MS 2000
+#define JSON_RING_SIZE 8192                 // Download-to-parser ring buffer (power of two)
+#define DOWNLOAD_TASK_STACK 8192            // TLS record decryption runs on this task
 
 // Refresh Intervals
 #define REFRESH_INTERVAL_DAY_MS 600000      // 10 minutes (default)
 #define REFRESH_INTERVAL_NIGHT_MS 3600000   // 60 minutes (default)
 #define NIGHT_START_HOUR 22
 #define NIGHT_END_HOUR 5
+#define DAY_INTERVAL_MIN 5                  // Minutes, bounds the portal accepts
+#define DAY_INTERVAL_MAX 120
+#define NIGHT_INTERVAL_MIN 15
+#define NIGHT_INTERVAL_MAX 240
 
 // User Interaction
 #define USER_INTERACTION_TIMEOUT_MS 30000   // 30 seconds to tap screen before sleep
 #define CFG_BUTTON_TOUCH_WIDTH 100          // Width of touchable CFG area
 #define CFG_BUTTON_TOUCH_HEIGHT 40          // Height of touchable CFG area
 
+// Micro-wake (radio-free clock refresh between weather fetches)
+#define MICRO_WAKE_INTERVAL_S 60            // Redraw the clock once a minute
+#define MICRO_WAKE_MIN_LEAD_S 20            // Do a full wake instead if refresh is this close
+#define MIN_VALID_EPOCH 1704067200          // 2024-01-01, earlier means RTC was never set
+
 // Weather Data Limits
-#define MAX_HOURLY 8
+#define MAX_HOURLY 8                        // Hours shown in the hourly row
 #define MAX_FORECAST 7
+#define HOURLY_GRAPH_HOURS 48               // Hours the hourly graphs span, 24-48
+// Plus the hour in progress and slack for later renders, rounded up to an
+// even count so the hourly arrays pack without padding
+#define HOURLY_CAPACITY ((HOURLY_GRAPH_HOURS + 5) & ~1)
 
 // Screen Dimensions
 #define SCREEN_WIDTH 960
 #define SCREEN_HEIGHT 540
+#define CANVAS_COLOR_DEPTH 4                // 16 gray levels, matches the EPD panel
+
+// Display List (recorded draw commands, see displaylist.h)
+#define DISPLAY_LIST_SIZE 8192              // Arena bytes per list (chrome or content)
+#define MAX_DIRTY_RECTS 16                  // Changed regions pushed separately before merging
+#define MAX_POLYGON_POINTS 8
+#define BAND_HEIGHT 60                      // Rows per strip when rendering in bands (28.8 KB of SRAM)
+#define RENDER_TILE_COUNT 6                 // Horizontal tiles shared out between the two cores
+#define RENDER_TASK_STACK 4096
+
+// Framebuffer Snapshot (flash partition "frame", see partitions.csv)
+#define FRAME_PARTITION_LABEL "frame"
+#define FRAME_PARTITION_SUBTYPE 0x40
+#define FRAME_SLOT_SIZE 0x20000             // 128 KB per snapshot, slots rotate for wear levelling
+#define FULL_REFRESH_INTERVAL 6             // Full-quality refresh after this many partial ones
+#define PARTIAL_REFRESH_MODE epd_mode_t::epd_text  // epd_fast/epd_fastest switch weather icons to 1bpp
+
+// Static Chrome Cache (flash partition "chrome")
+#define CHROME_PARTITION_LABEL "chrome"
+#define CHROME_PARTITION_SUBTYPE 0x41
+#define LAYOUT_VERSION 3                    // Bump when panel geometry or chrome changes
+
+// Asset Store (flash partition "assets", built by tools/gen_assets.py)
+#define ASSET_PARTITION_LABEL "assets"
+#define ASSET_PARTITION_SUBTYPE 0x42
+#define ICON_CACHE_SLOTS 16                 // Decoded icons kept in RAM, 2 KB each
 
 // Display Layout Constants
 #define HEADER_HEIGHT 34
@@ -42,14 +88,11 @@
 // Current Conditions Panel
 #define CURRENT_PANEL_SPACING 54
 #define MAIN_TEMP_Y_OFFSET 50
-#define TEMP_DEGREE_RADIUS_LARGE 8
-#define TEMP_DEGREE_OFFSET 42
+#define MAIN_TEMP_GLYPH_Y_OFFSET 6
 #define WEATHER_ICON_SIZE 64
 #define CONDITION_Y_OFFSET 90
 #define FEELS_LIKE_Y_OFFSET 185
-#define FEELS_LIKE_DEGREE_RADIUS 5
 #define TODAY_TEMP_Y_OFFSET 220
-#define TODAY_TEMP_DEGREE_RADIUS 3
 
 // Compass Constants
 #define COMPASS_RADIUS 75
@@ -63,14 +106,18 @@
 #define GRAPH_AREA_Y_OFFSET 35
 #define GRAPH_BOTTOM_MARGIN 20
 #define GRAPH_SIDE_MARGIN 20
-#define GRAPH_TEXT_WIDTH_FACTOR 3.5
+#define GRAPH_LABEL_GUTTER 19  // Room for 4-character y labels at text size 1
 #define GRAPH_POINT_RADIUS 2
+#define GRAPH_POINT_PITCH 6    // Closest marker spacing; denser markers are LTTB-thinned
+#define GRAPH_LABEL_PITCH 14   // Closest x label spacing
 #define GRAPH_DASH_LENGTH 5
 #define GRAPH_DASH_SPACING 10
-
-// Icon Rendering
-#define ICON_GRAYSCALE_DIVISOR 4096
-#define ICON_COLOR_MULTIPLIER 0x1111
+#define GRAPH_DOT_SPACING 4
+#define GRAPH_BAR_COLOR 0x8410
+#define GRAPH_ROW_Y 408
+#define GRAPH_ROW_HEIGHT 122
+#define GRAPH_PANEL_COUNT 5
+#define GRAPH_PANEL_WIDTH 186
 
 // Battery and Signal
 #define BATTERY_WIDTH 40
@@ -100,21 +147,40 @@
 #define SENSOR_ERROR_VALUE -999.0
 #define COORD_NOT_SET -9999.0
 
+// Settings (one NVS blob, see config.h)
+#define CONFIG_BLOB_KEY "cfg"
+#define CONFIG_VERSION 3                    // Bump when fields are appended to Config
+
 // Config Portal
 #define CONFIG_AP_SSID "M5Paper-Weather"
 #define CONFIG_AP_PASSWORD "configure"
 #define CONFIG_AP_IP "192.168.4.1"
 
+// Serial Logging
+#define LOG_LINE_SIZE 160                   // Stack buffer for logPrintf()
+
 // Time Constants
-#define JULIAN_REF_DATE 2451550.26
-#define LUNAR_CYCLE_DAYS 29.53058867
-#define DEFAULT_SUNRISE_HOUR 6
+#define DEFAULT_SUNRISE_HOUR 6              // Until the sun has been computed (no valid time)
 #define DEFAULT_SUNSET_HOUR 18
+#define ASTRO_CACHE_KEY "astro"             // Today's sun and moon events (astro.h)
 
 // NTP Configuration
 #define NTP_SERVER_1 "pool.ntp.org"
 #define NTP_SERVER_2 "time.nist.gov"
-#define TIMEZONE_OFFSET_HOURS 13  // Auckland default
+#define NTP_TIMEOUT_MS 5000
+
+// RTC drift compensation (clock_sync.h)
+#define CLOCK_SYNC_KEY "clock"              // Drift estimate and last server sync
+#define CLOCK_MAX_ERROR_S 2                 // Resync once the predicted RTC error exceeds this
+#define CLOCK_DRIFT_BASELINE_S 86400        // Shortest interval a drift estimate is taken over
+#define CLOCK_UNKNOWN_DRIFT_PPB 30000       // Assumed error before the drift was measured (BM8563 crystal)
+#define CLOCK_RESIDUAL_DRIFT_PPB 3000       // Assumed error left after correcting for it
+#define CLOCK_MAX_DRIFT_PPB 200000          // Larger measurements mean the RTC lost power or was reset
+#define SNTP_PORT 123
+#define SNTP_LOCAL_PORT 2390
+#define SNTP_TIMEOUT_MS 1000
+#define DEFAULT_TIMEZONE "NZST-12NZDT,M9.5.0,M4.1.0/3"  // Auckland, until a forecast reports the zone
+#define LEGACY_RTC_OFFSET_S (13 * 3600)     // Fixed UTC+13 older firmware kept the RTC in, DST or not
 
 // Color Definitions
 #ifndef TFT_WHITE
@@ -1,348 +1,259 @@
 #include "display.h"
 #include "constants.h"
 #include "utils.h"
-#include "Icons.h"
+#include "framestore.h"
+#include "chromecache.h"
+#include "fixed_trig.h"
+#include "graph.h"
+#include "glyphs.h"
+#include "layout.h"
+#include "displaylist.h"
+#include "canvas_backend.h"
+#include "tile_render.h"
+#include "config.h"
+#include "alloc_counter.h"
+#include "astro.h"
+#include <utility>
 #include <WiFi.h>
 
 extern WeatherData currentWeather;
 extern M5Canvas canvas;
-extern String cityName;
-
-void drawIcon(int x, int y, const uint8_t *icon, int dx, int dy, bool highContrast) {
-    const uint16_t *icon16 = (const uint16_t *)icon;
-
-    for (int yi = 0; yi < dy; yi++) {
-        for (int xi = 0; xi < dx; xi++) {
-            uint16_t pixel = icon16[yi * dx + xi];
-            int grayscale = 15 - (pixel / ICON_GRAYSCALE_DIVISOR);
-
-            if (highContrast) {
-                if (grayscale > 0) {
-                    canvas.drawPixel(x + xi, y + yi, TFT_BLACK);
-                }
-            } else {
-                uint16_t color = 0xFFFF - (grayscale * ICON_COLOR_MULTIPLIER);
-                canvas.drawPixel(x + xi, y + yi, color);
-            }
-        }
+
+// Commands for the frame being rendered, and the content list of the frame on
+// the glass (restored with the frame snapshot) to diff against
+static uint8_t displayListArena[DISPLAY_LIST_SIZE];
+static uint8_t previousListArena[DISPLAY_LIST_SIZE];
+DisplayList displayList(displayListArena, DISPLAY_LIST_SIZE);
+DisplayList previousList(previousListArena, DISPLAY_LIST_SIZE);
+
+// Strip buffer for banded rendering when the full-screen canvas does not fit
+static M5Canvas bandCanvas(&M5.Display);
+extern time_t lastFetchTime;
+extern int refreshCounter;
+extern bool frameRestored;
+
+// Depth of the weather icons recorded for the next push: the fast waveforms
+// only settle black and white, so they get the 1bpp set (see setWaveform())
+static IconDepth contentIconDepth = ICON_GRAY4;
+
+static void setWaveform(epd_mode_t mode) {
+    M5.Display.setEpdMode(mode);
+    bool fast = mode == epd_mode_t::epd_fast || mode == epd_mode_t::epd_fastest;
+    contentIconDepth = fast ? ICON_MONO1 : ICON_GRAY4;
+}
+
+// Icons are decoded from the asset partition as they are recorded; without
+// the partition they are left out
+void drawIcon(int x, int y, IconImage image, IconDepth depth) {
+    if (loadIcon(image, depth)) displayList.drawIcon(x, y, image, depth);
+}
+
+void drawArcPixels(int cx, int cy, int r, int fromDeg, int toDeg, uint32_t color) {
+    displayList.drawArc(cx, cy, r, fromDeg, toDeg, color);
+}
+
+void fillRotatedPolygon(int cx, int cy, const int16_t points[][2], int count, int32_t deci, uint32_t color) {
+    int16_t rotated[MAX_POLYGON_POINTS][2];
+    if (count > MAX_POLYGON_POINTS) count = MAX_POLYGON_POINTS;
+    for (int i = 0; i < count; i++) {
+        rotated[i][0] = cx + rotateX(points[i][0], points[i][1], deci);
+        rotated[i][1] = cy + rotateY(points[i][0], points[i][1], deci);
     }
+    displayList.fillPolygon(rotated, count, color);
 }
 
 void drawRSSI(int x, int y, int rssi) {
     int quality = getRSSIQuality(rssi);
 
-    auto drawArc = [&](int cx, int cy, int r, int fromDeg, int toDeg) {
-        for (int i = fromDeg; i < toDeg; i++) {
-            double rad = i * PI / 180;
-            int px = cx + r * cos(rad);
-            int py = cy + r * sin(rad);
-            canvas.drawPixel(px, py, TFT_BLACK);
-        }
-    };
-
-    if (quality >= 80) drawArc(x + 12, y, 16, 225, 315);
-    if (quality >= 40) drawArc(x + 12, y, 12, 225, 315);
-    if (quality >= 20) drawArc(x + 12, y, 8, 225, 315);
-    if (quality >= 10) drawArc(x + 12, y, 4, 225, 315);
-    drawArc(x + 12, y, 2, 225, 315);
+    if (quality >= 80) drawArcPixels(x + 12, y, 16, 225, 315, TFT_BLACK);
+    if (quality >= 40) drawArcPixels(x + 12, y, 12, 225, 315, TFT_BLACK);
+    if (quality >= 20) drawArcPixels(x + 12, y, 8, 225, 315, TFT_BLACK);
+    if (quality >= 10) drawArcPixels(x + 12, y, 4, 225, 315, TFT_BLACK);
+    drawArcPixels(x + 12, y, 2, 225, 315, TFT_BLACK);
 }
 
 void drawBattery(int x, int y, int batteryPercent) {
-    canvas.drawRect(x, y, BATTERY_WIDTH, BATTERY_HEIGHT, TFT_BLACK);
-    canvas.drawRect(x + BATTERY_WIDTH, y + BATTERY_TIP_OFFSET, BATTERY_TIP_WIDTH, BATTERY_TIP_HEIGHT, TFT_BLACK);
-
-    // Fill battery based on percentage
-    for (int i = x; i < x + BATTERY_WIDTH; i++) {
-        canvas.drawLine(i, y, i, y + BATTERY_HEIGHT - 1, TFT_BLACK);
-        if ((i - x) * 100.0 / BATTERY_WIDTH > batteryPercent) {
-            break;
-        }
-    }
+    displayList.drawRect(x, y, BATTERY_WIDTH, BATTERY_HEIGHT, TFT_BLACK);
+    displayList.drawRect(x + BATTERY_WIDTH, y + BATTERY_TIP_OFFSET, BATTERY_TIP_WIDTH, BATTERY_TIP_HEIGHT, TFT_BLACK);
+
+    // Fill battery based on percentage, one column past the exact level
+    int fill = min(BATTERY_WIDTH, batteryPercent * BATTERY_WIDTH / 100 + 2);
+    displayList.fillRect(x, y, fill, BATTERY_HEIGHT, TFT_BLACK);
 }
 
 void drawArrow(int x, int y, int asize, float aangle, int pwidth, int plength) {
-    float dx = (asize + 21) * cos((aangle - 90) * PI / 180) + x;
-    float dy = (asize + 21) * sin((aangle - 90) * PI / 180) + y;
-    float x1 = 0;           float y1 = plength;
-    float x2 = pwidth / 2;  float y2 = pwidth / 2;
-    float x3 = -pwidth / 2; float y3 = pwidth / 2;
-    float angle = aangle * PI / 180;
-    float xx1 = x1 * cos(angle) - y1 * sin(angle) + dx;
-    float yy1 = y1 * cos(angle) + x1 * sin(angle) + dy;
-    float xx2 = x2 * cos(angle) - y2 * sin(angle) + dx;
-    float yy2 = y2 * cos(angle) + x2 * sin(angle) + dy;
-    float xx3 = x3 * cos(angle) - y3 * sin(angle) + dx;
-    float yy3 = y3 * cos(angle) + x3 * sin(angle) + dy;
-    canvas.fillTriangle(xx1, yy1, xx3, yy3, xx2, yy2, TFT_BLACK);
+    int32_t deci = lroundf(aangle * 10);
+    int tipX = x + polarX(asize + 21, deci - TRIG_QUARTER);
+    int tipY = y + polarY(asize + 21, deci - TRIG_QUARTER);
+
+    // Arrow head in local coordinates, pointing along +y before rotation
+    int16_t half = pwidth / 2;
+    const int16_t head[3][2] = { { 0, (int16_t)plength }, { (int16_t)-half, half }, { half, half } };
+    fillRotatedPolygon(tipX, tipY, head, 3, deci, TFT_BLACK);
 }
 
-void drawWindCompass(int x, int y, float angle, float windspeed, int radius) {
-    int dxo, dyo, dxi, dyi;
-
-    canvas.setTextSize(2);
-    canvas.drawCircle(x, y, radius, TFT_BLACK);
-    canvas.drawCircle(x, y, radius + 1, TFT_BLACK);
-    canvas.drawCircle(x, y, radius * 0.7, TFT_BLACK);
-
-    // Draw compass ticks
-    for (float a = 0; a < 360; a += 22.5) {
-        dxo = radius * cos((a - 90) * PI / 180);
-        dyo = radius * sin((a - 90) * PI / 180);
-
-        dxi = dxo * 0.9;
-        dyi = dyo * 0.9;
-        canvas.drawLine(dxo + x, dyo + y, dxi + x, dyi + y, TFT_BLACK);
-
-        dxo = dxo * 0.7;
-        dyo = dyo * 0.7;
-        dxi = dxo * 0.9;
-        dyi = dyo * 0.9;
-        canvas.drawLine(dxo + x, dyo + y, dxi + x, dyi + y, TFT_BLACK);
+void drawWindCompassChrome(int x, int y, int radius) {
+    int innerRadius = radius * 7 / 10;
+
+    displayList.setTextSize(2);
+    displayList.drawCircle(x, y, radius, TFT_BLACK);
+    displayList.drawCircle(x, y, radius + 1, TFT_BLACK);
+    displayList.drawCircle(x, y, innerRadius, TFT_BLACK);
+
+    // Draw compass ticks every 22.5 degrees on both rings, each 10% of the ring radius long
+    for (int deci = 0; deci < TRIG_FULL_CIRCLE; deci += 225) {
+        int a = deci - TRIG_QUARTER;
+        displayList.drawLine(x + polarX(radius, a), y + polarY(radius, a),
+                        x + polarX(radius * 9 / 10, a), y + polarY(radius * 9 / 10, a), TFT_BLACK);
+        displayList.drawLine(x + polarX(innerRadius, a), y + polarY(innerRadius, a),
+                        x + polarX(innerRadius * 9 / 10, a), y + polarY(innerRadius * 9 / 10, a), TFT_BLACK);
     }
 
     // Draw cardinal directions
     int labelOffset = radius + COMPASS_LABEL_OFFSET;
-    canvas.setTextDatum(TC_DATUM);
-    canvas.drawString("N", x, y - labelOffset);
-    canvas.drawString("S", x, y + labelOffset - 8);
+    displayList.setTextDatum(TC_DATUM);
+    displayList.drawString("N", x, y - labelOffset);
+    displayList.drawString("S", x, y + labelOffset - 8);
 
-    canvas.setTextDatum(MC_DATUM);
-    canvas.drawString("W", x - labelOffset, y);
-    canvas.drawString("E", x + labelOffset, y);
+    displayList.setTextDatum(MC_DATUM);
+    displayList.drawString("W", x - labelOffset, y);
+    displayList.drawString("E", x + labelOffset, y);
 
     // Draw intercardinal directions
     int diagOffset = (int)(labelOffset * COMPASS_DIAG_FACTOR);
-    canvas.setTextDatum(BR_DATUM);
-    canvas.drawString("NE", x + diagOffset + 10, y - diagOffset);
-    canvas.setTextDatum(TR_DATUM);
-    canvas.drawString("SE", x + diagOffset + 10, y + diagOffset);
-    canvas.setTextDatum(TL_DATUM);
-    canvas.drawString("SW", x - diagOffset - 10, y + diagOffset);
-    canvas.setTextDatum(BL_DATUM);
-    canvas.drawString("NW", x - diagOffset - 10, y - diagOffset);
+    displayList.setTextDatum(BR_DATUM);
+    displayList.drawString("NE", x + diagOffset + 10, y - diagOffset);
+    displayList.setTextDatum(TR_DATUM);
+    displayList.drawString("SE", x + diagOffset + 10, y + diagOffset);
+    displayList.setTextDatum(TL_DATUM);
+    displayList.drawString("SW", x - diagOffset - 10, y + diagOffset);
+    displayList.setTextDatum(BL_DATUM);
+    displayList.drawString("NW", x - diagOffset - 10, y - diagOffset);
+
+    // Speed unit depends only on the unit setting, which is part of the chrome key
+    displayList.setTextDatum(TC_DATUM);
+    displayList.drawString(config.useCelsius ? "km/h" : "mph", x, y);
+    displayList.setTextDatum(TL_DATUM);
+}
 
+void drawWindCompass(int x, int y, float angle, float windspeed, int radius) {
     // Draw wind speed
-    String speedUnit = useCelsius ? "km/h" : "mph";
-    canvas.setTextDatum(TC_DATUM);
-    canvas.drawString(String(windspeed, 1), x, y - 20);
-    canvas.drawString(speedUnit, x, y);
-    canvas.setTextDatum(TL_DATUM);
+    displayList.setTextSize(2);
+    displayList.setTextDatum(TC_DATUM);
+    char speedStr[12];
+    displayList.drawString(formatTenths(speedStr, sizeof(speedStr), windspeed), x, y - 20);
+    displayList.setTextDatum(TL_DATUM);
 
     // Draw wind direction arrow
     drawArrow(x, y, radius - 17, angle, COMPASS_ARROW_SIZE, COMPASS_ARROW_LENGTH);
 }
 
-void drawHourlyForecast(int x, int y, int dx, int dy, int index) {
-    struct tm timeinfo;
-    if (!getLocalTime(&timeinfo)) {
-        timeinfo.tm_hour = 0;
-    }
-    int forecastHour = (timeinfo.tm_hour + index + 1) % 24;
+// First hourly slot shown: the hour after the one in progress at render time
+static int firstHourlySlot() {
+    return hourlySlotAt(forecastNow()) + 1;
+}
 
-    canvas.setTextSize(2);
-    canvas.setTextDatum(TC_DATUM);
+void drawHourlyForecast(int x, int y, int dx, int dy, int slot) {
+    int forecastHour = slotLocalHour(slot);
+
+    displayList.setTextSize(2);
+    displayList.setTextDatum(TC_DATUM);
     char hourStr[6];
     sprintf(hourStr, "%02d:00", forecastHour);
-    canvas.drawString(hourStr, x + dx / 2, y + 10);
-    canvas.drawString(formatTemp(currentWeather.hourly[index].temp), x + dx / 2, y + 30);
-    canvas.setTextDatum(TL_DATUM);
+    displayList.drawString(hourStr, x + dx / 2, y + 10);
+    displayList.setTextDatum(TL_DATUM);
+
+    // Past the end of the stored forecast: label only
+    if (!hasHourly(slot)) return;
+    const HourlySeries &hourly = currentWeather.hourly;
+
+    char tempStr[8];
+    snprintf(tempStr, sizeof(tempStr), "%d\xB0%c", fixedWhole(hourly.temp[slot], TEMP_SCALE), config.useCelsius ? 'C' : 'F');
+    drawGlyphText(GLYPH_FONT_S, tempStr, x + dx / 2, y + 30, TC_DATUM);
 
     bool isDay = isDaytime(forecastHour);
     int iconX = x + dx / 2 - 32;
     int iconY = y + 50;
-    const uint8_t* weatherIcon = getWeatherIcon(currentWeather.hourly[index].weatherCode, isDay);
-    drawIcon(iconX, iconY, weatherIcon, WEATHER_ICON_SIZE, WEATHER_ICON_SIZE, true);
-}
-
-void drawGraph(int x, int y, int dx, int dy, String title, int xMin, int xMax, float yMin, float yMax, float values[]) {
-    String yMinString = String((int)yMin);
-    String yMaxString = String((int)yMax);
-    int textWidth = 5 + max(yMinString.length() * GRAPH_TEXT_WIDTH_FACTOR, yMaxString.length() * GRAPH_TEXT_WIDTH_FACTOR);
-
-    int graphX = x + 5 + textWidth + 5;
-    int graphY = y + GRAPH_AREA_Y_OFFSET;
-    int graphDX = dx - textWidth - GRAPH_SIDE_MARGIN;
-    int graphDY = dy - GRAPH_AREA_Y_OFFSET - GRAPH_BOTTOM_MARGIN;
-    float xStep = graphDX / (float)(xMax - xMin);
-    float yStep = graphDY / (yMax - yMin);
-
-    // Draw title
-    canvas.setTextSize(2);
-    canvas.setTextDatum(TC_DATUM);
-    canvas.drawString(title, x + dx / 2, y + GRAPH_TITLE_Y_OFFSET);
-    canvas.setTextDatum(TL_DATUM);
-
-    // Draw Y-axis labels
-    canvas.setTextSize(1);
-    canvas.drawString(yMaxString, x + 5, graphY - 5);
-    canvas.drawString(yMinString, x + 5, graphY + graphDY - 3);
-
-    // Draw X-axis labels
-    for (int i = 0; i <= (xMax - xMin); i++) {
-        canvas.drawString(String(i), graphX + i * xStep, graphY + graphDY + 5);
-    }
-
-    // Draw graph border
-    canvas.drawRect(graphX, graphY, graphDX, graphDY, TFT_BLACK);
-
-    // Draw zero line if applicable
-    if (yMin < 0 && yMax > 0) {
-        float yValueDX = (float)graphDY / (yMax - yMin);
-        int yPos = graphY + graphDY - (0.0 - yMin) * yValueDX;
-        if (yPos > graphY && yPos < graphY + graphDY) {
-            canvas.drawString("0", graphX - 20, yPos);
-            for (int xDash = graphX; xDash < graphX + graphDX - GRAPH_DASH_SPACING; xDash += GRAPH_DASH_SPACING) {
-                canvas.drawLine(xDash, yPos, xDash + GRAPH_DASH_LENGTH, yPos, TFT_BLACK);
-            }
-        }
-    }
+    drawIcon(iconX, iconY, getWeatherIcon(hourly.weatherCode[slot], isDay), contentIconDepth);
+}
 
-    // Plot data points and lines
-    int lastX = -1, lastY = -1;
-    for (int i = xMin; i <= xMax; i++) {
-        float yValue = values[i - xMin];
-        float yValueDY = (float)graphDY / (yMax - yMin);
-        int xPos = graphX + graphDX / (xMax - xMin) * i;
-        int yPos = graphY + graphDY - (yValue - yMin) * yValueDY;
-
-        // Clamp to graph bounds
-        if (yPos > graphY + graphDY) yPos = graphY + graphDY;
-        if (yPos < graphY) yPos = graphY;
-
-        canvas.fillCircle(xPos, yPos, GRAPH_POINT_RADIUS, TFT_BLACK);
-        if (i > xMin) {
-            canvas.drawLine(lastX, lastY, xPos, yPos, TFT_BLACK);
-        }
-        lastX = xPos;
-        lastY = yPos;
+void drawHourlyRowChrome(int x, int y, int dx, int dy) {
+    displayList.drawRect(x, y, dx, dy, TFT_BLACK);
+    for (int i = 0; i < MAX_HOURLY; i++) {
+        int cellX = x + i * HOURLY_CELL_WIDTH;
+        displayList.drawLine(cellX, y, cellX, y + dy, TFT_BLACK);
     }
 }
 
-void drawTempGraph(int x, int y, int dx, int dy, String title, int xMin, int xMax, float yMin, float yMax, float highValues[], float lowValues[]) {
-    String yMinString = String((int)yMin);
-    String yMaxString = String((int)yMax);
-    int textWidth = 5 + max(yMinString.length() * GRAPH_TEXT_WIDTH_FACTOR, yMaxString.length() * GRAPH_TEXT_WIDTH_FACTOR);
-
-    int graphX = x + 5 + textWidth + 5;
-    int graphY = y + GRAPH_AREA_Y_OFFSET;
-    int graphDX = dx - textWidth - GRAPH_SIDE_MARGIN;
-    int graphDY = dy - GRAPH_AREA_Y_OFFSET - GRAPH_BOTTOM_MARGIN;
-    float xStep = graphDX / (float)(xMax - xMin);
-    float yStep = graphDY / (yMax - yMin);
-
-    // Draw title
-    canvas.setTextSize(2);
-    canvas.setTextDatum(TC_DATUM);
-    canvas.drawString(title, x + dx / 2, y + GRAPH_TITLE_Y_OFFSET);
-    canvas.setTextDatum(TL_DATUM);
-
-    // Draw Y-axis labels
-    canvas.setTextSize(1);
-    canvas.drawString(yMaxString, x + 5, graphY - 5);
-    canvas.drawString(yMinString, x + 5, graphY + graphDY - 3);
-
-    // Draw X-axis labels
-    for (int i = 0; i <= (xMax - xMin); i++) {
-        canvas.drawString(String(i), graphX + i * xStep, graphY + graphDY + 5);
+void drawHourlyRow(int x, int y, int dx, int dy) {
+    int first = firstHourlySlot();
+    for (int i = 0; i < MAX_HOURLY; i++) {
+        drawHourlyForecast(x + i * HOURLY_CELL_WIDTH, y, HOURLY_CELL_WIDTH, dy, first + i);
     }
+}
 
-    // Draw graph border
-    canvas.drawRect(graphX, graphY, graphDX, graphDY, TFT_BLACK);
-
-    // Plot high temperatures
-    int lastHighX = -1, lastHighY = -1;
-    for (int i = xMin; i <= xMax; i++) {
-        float yValue = highValues[i - xMin];
-        float yValueDY = (float)graphDY / (yMax - yMin);
-        int xPos = graphX + graphDX / (xMax - xMin) * i;
-        int yPos = graphY + graphDY - (yValue - yMin) * yValueDY;
+// Graph row: four hourly panels and the 7-day temperature band, relative to the row
+#define GRAPH_PANEL_X(i) ((i) * GRAPH_PANEL_WIDTH)
+
+static const GraphPanel graphPanels[GRAPH_PANEL_COUNT] = {
+    { GRAPH_PANEL_X(0), 0, GRAPH_PANEL_WIDTH, GRAPH_ROW_HEIGHT, "UV Index", HOURLY_GRAPH_HOURS, UV_SCALE, 0, 12 * UV_SCALE, false },
+    { GRAPH_PANEL_X(1), 0, GRAPH_PANEL_WIDTH, GRAPH_ROW_HEIGHT, "Precip (%)", HOURLY_GRAPH_HOURS, 1, 0, 100, false },
+    { GRAPH_PANEL_X(2), 0, GRAPH_PANEL_WIDTH, GRAPH_ROW_HEIGHT, "Humidity (%)", HOURLY_GRAPH_HOURS, 1, 0, 100, false },
+    { GRAPH_PANEL_X(3), 0, GRAPH_PANEL_WIDTH, GRAPH_ROW_HEIGHT, "Pressure (hPa)", HOURLY_GRAPH_HOURS, PRESSURE_SCALE,
+      980 * PRESSURE_SCALE, 1040 * PRESSURE_SCALE, false },
+    { GRAPH_PANEL_X(4), 0, GRAPH_PANEL_WIDTH, GRAPH_ROW_HEIGHT, "7-Day Temp", MAX_FORECAST, TEMP_SCALE, 0, 30 * TEMP_SCALE, true },
+};
+
+void drawGraphRowChrome(int x, int y, int dx, int dy) {
+    displayList.drawRect(x, y, dx, dy, TFT_BLACK);
+    drawGraphFrames(graphPanels, GRAPH_PANEL_COUNT, x, y);
+}
 
-        if (yPos > graphY + graphDY) yPos = graphY + graphDY;
-        if (yPos < graphY) yPos = graphY;
+void drawGraphRow(int x, int y, int dx, int dy) {
+    // Plotted in place from the forecast arrays, from the same hour as the
+    // hourly row; missing hours plot as zero
+    const HourlySeries &hourly = currentWeather.hourly;
+    const DailySeries &daily = currentWeather.daily;
+    int first = firstHourlySlot();
+    int16_t scratch[4][HOURLY_GRAPH_HOURS];
+
+    const GraphSeries series[] = {
+        { hourlyWindow(hourly.uvIndex, first, scratch[0]), GRAPH_SOLID },
+        { hourlyWindow(hourly.precipChance, first, scratch[1]), GRAPH_BARS },
+        { hourlyWindow(hourly.humidity, first, scratch[2]), GRAPH_SOLID },
+        { hourlyWindow(hourly.pressure, first, scratch[3]), GRAPH_SOLID },
+        { daily.maxTemp, GRAPH_SOLID },
+        { daily.minTemp, GRAPH_DOTTED },
+    };
+    static const uint8_t seriesCount[GRAPH_PANEL_COUNT] = { 1, 1, 1, 1, 2 };
 
-        canvas.fillCircle(xPos, yPos, GRAPH_POINT_RADIUS, TFT_BLACK);
-        if (i > xMin) {
-            canvas.drawLine(lastHighX, lastHighY, xPos, yPos, TFT_BLACK);
-        }
-        lastHighX = xPos;
-        lastHighY = yPos;
-    }
+    drawGraphs(graphPanels, GRAPH_PANEL_COUNT, x, y, series, seriesCount);
+}
 
-    // Plot low temperatures
-    int lastLowX = -1, lastLowY = -1;
-    for (int i = xMin; i <= xMax; i++) {
-        float yValue = lowValues[i - xMin];
-        float yValueDY = (float)graphDY / (yMax - yMin);
-        int xPos = graphX + graphDX / (xMax - xMin) * i;
-        int yPos = graphY + graphDY - (yValue - yMin) * yValueDY;
+void drawPanelTitle(int x, int y, int dx, const char *title) {
+    displayList.setTextSize(3);
+    displayList.setTextDatum(TC_DATUM);
+    displayList.drawString(title, x + dx / 2, y + 7);
+    displayList.setTextDatum(TL_DATUM);
+    displayList.drawLine(x, y + PANEL_TITLE_HEIGHT, x + dx, y + PANEL_TITLE_HEIGHT, TFT_BLACK);
+}
 
-        if (yPos > graphY + graphDY) yPos = graphY + graphDY;
-        if (yPos < graphY) yPos = graphY;
+void drawCurrentConditionsChrome(int x, int y, int dx, int dy) {
+    drawPanelTitle(x, y, dx, "Current");
 
-        canvas.fillCircle(xPos, yPos, GRAPH_POINT_RADIUS, TFT_BLACK);
-        if (i > xMin) {
-            canvas.drawLine(lastLowX, lastLowY, xPos, yPos, TFT_BLACK);
-        }
-        lastLowX = xPos;
-        lastLowY = yPos;
-    }
-
-    // Plot average temperature (dotted line)
-    int lastAvgX = -1, lastAvgY = -1;
-    for (int i = xMin; i <= xMax; i++) {
-        float avgValue = (highValues[i - xMin] + lowValues[i - xMin]) / 2.0;
-        float yValueDY = (float)graphDY / (yMax - yMin);
-        int xPos = graphX + graphDX / (xMax - xMin) * i;
-        int yPos = graphY + graphDY - (avgValue - yMin) * yValueDY;
-
-        if (yPos > graphY + graphDY) yPos = graphY + graphDY;
-        if (yPos < graphY) yPos = graphY;
-
-        canvas.fillCircle(xPos, yPos, 1, TFT_BLACK);
-        if (i > xMin) {
-            // Draw dotted line
-            int dx = xPos - lastAvgX;
-            int dy = yPos - lastAvgY;
-            float len = sqrt(dx*dx + dy*dy);
-            for (float t = 0; t < len; t += 5) {
-                int px = lastAvgX + (dx * t / len);
-                int py = lastAvgY + (dy * t / len);
-                canvas.drawPixel(px, py, TFT_BLACK);
-            }
-        }
-        lastAvgX = xPos;
-        lastAvgY = yPos;
-    }
+    displayList.setTextSize(2);
+    displayList.drawString("Feels Like:", x + dx / 4 - 35, y + FEELS_LIKE_Y_OFFSET);
 }
 
 void drawCurrentConditions(int x, int y, int dx, int dy) {
-    canvas.setTextSize(3);
-    canvas.setTextDatum(TC_DATUM);
-    canvas.drawString("Current", x + dx / 2, y + 7);
-    canvas.setTextDatum(TL_DATUM);
-    canvas.drawLine(x, y + PANEL_TITLE_HEIGHT, x + dx, y + PANEL_TITLE_HEIGHT, TFT_BLACK);
-
     int spacing = dx / 4;
 
-    // Draw main temperature (large font)
-    canvas.setFont(&fonts::FreeSansBold24pt7b);
-    canvas.setTextSize(2);
-    canvas.setTextDatum(TC_DATUM);
-
-    String tempNum = String((int)currentWeather.temperature);
+    // Draw main temperature from the pre-rasterised atlas
+    char tempStr[8];
+    snprintf(tempStr, sizeof(tempStr), "%d\xB0", fixedWhole(currentWeather.temperature, TEMP_SCALE));
     int mainTempX = x + spacing;
     int mainTempY = y + MAIN_TEMP_Y_OFFSET;
-    canvas.drawString(tempNum, mainTempX, mainTempY);
-
-    // Draw degree symbol for main temperature
-    int tempWidth = canvas.textWidth(tempNum) * 2;
-    int degreeX = mainTempX + tempWidth / 2 - TEMP_DEGREE_OFFSET;
-    int degreeY = mainTempY + 13;
-    drawDegreeSymbol(degreeX, degreeY, TEMP_DEGREE_RADIUS_LARGE);
-
-    canvas.setFont(nullptr);
-    canvas.setTextFont(1);
-    canvas.setTextSize(1);
+    drawGlyphText(GLYPH_FONT_XL, tempStr, mainTempX, mainTempY + MAIN_TEMP_GLYPH_Y_OFFSET, TC_DATUM);
 
     // Draw weather icon
     struct tm timeinfo;
@@ -353,246 +264,473 @@ void drawCurrentConditions(int x, int y, int dx, int dy) {
 
     int iconX = x + dx - spacing - 25;
     int iconY = mainTempY - 2;
-    const uint8_t* weatherIcon = getWeatherIcon(currentWeather.weatherCode, isDay);
-    drawIcon(iconX, iconY, weatherIcon, WEATHER_ICON_SIZE, WEATHER_ICON_SIZE, true);
+    drawIcon(iconX, iconY, getWeatherIcon(currentWeather.weatherCode, isDay), contentIconDepth);
 
     // Draw condition text
-    String condition = getWeatherConditionText(currentWeather.weatherCode);
-    canvas.setTextDatum(TC_DATUM);
+    const char *condition = getWeatherConditionText(currentWeather.weatherCode);
+    displayList.setTextSize(1);
+    displayList.setTextDatum(TC_DATUM);
 
     int conditionY = mainTempY + CONDITION_Y_OFFSET;
     int availableWidth = dx - 20;
-    int textWidth = canvas.textWidth(condition) * 3;
+    int textWidth = displayList.textWidth(condition) * 3;
 
     if (textWidth > availableWidth) {
-        canvas.setTextSize(2);
+        displayList.setTextSize(2);
     } else {
-        canvas.setTextSize(3);
+        displayList.setTextSize(3);
     }
-    canvas.drawString(condition, x + dx / 2, conditionY);
+    displayList.drawString(condition, x + dx / 2, conditionY);
 
     // Draw "Feels Like" temperature
     int feelsLikeY = y + FEELS_LIKE_Y_OFFSET;
 
-    canvas.setTextSize(2);
-    canvas.setTextDatum(TL_DATUM);
-    String feelsLikeLabel = "Feels Like:";
+    // The "Feels Like:" label itself is part of the chrome layer
+    displayList.setTextSize(2);
     int labelX = x + spacing - 35;
-    canvas.drawString(feelsLikeLabel, labelX, feelsLikeY);
-
-    int labelWidth = canvas.textWidth(feelsLikeLabel) * 2;
+    int labelWidth = displayList.textWidth("Feels Like:") * 2;
     int feelsLikeTempX = labelX + labelWidth - 130;
 
-    canvas.setTextSize(4);
-    canvas.setTextDatum(TL_DATUM);
-    String feelsTemp = String((int)currentWeather.apparentTemperature);
-    canvas.drawString(feelsTemp, feelsLikeTempX, feelsLikeY - 8);
-
-    // Draw degree symbol for "Feels Like"
-    int tempNumWidth = canvas.textWidth(feelsTemp);
-    int feelsLikeDegX = feelsLikeTempX + tempNumWidth + 3;
-    int feelsLikeDegY = feelsLikeY - 3;
-    drawDegreeSymbol(feelsLikeDegX, feelsLikeDegY, FEELS_LIKE_DEGREE_RADIUS);
+    snprintf(tempStr, sizeof(tempStr), "%d\xB0", fixedWhole(currentWeather.apparentTemperature, TEMP_SCALE));
+    drawGlyphText(GLYPH_FONT_L, tempStr, feelsLikeTempX, feelsLikeY - 8);
 
     // Draw today's low/high temperatures
-    canvas.setTextSize(3);
-    canvas.setTextDatum(TC_DATUM);
-
-    String lowTemp = "L:" + String((int)currentWeather.todayMinTemp);
-    String highTemp = "H:" + String((int)currentWeather.todayMaxTemp);
-
     int tempTextY = y + TODAY_TEMP_Y_OFFSET;
+    snprintf(tempStr, sizeof(tempStr), "L:%d\xB0", fixedWhole(currentWeather.todayMinTemp, TEMP_SCALE));
+    drawGlyphText(GLYPH_FONT_M, tempStr, x + spacing, tempTextY, TC_DATUM);
+    snprintf(tempStr, sizeof(tempStr), "H:%d\xB0", fixedWhole(currentWeather.todayMaxTemp, TEMP_SCALE));
+    drawGlyphText(GLYPH_FONT_M, tempStr, x + dx - spacing, tempTextY, TC_DATUM);
 
-    canvas.drawString(lowTemp, x + spacing, tempTextY);
-    canvas.drawString(highTemp, x + dx - spacing, tempTextY);
-
-    // Draw degree symbols for low/high
-    int lowDegX = x + spacing + canvas.textWidth(lowTemp) / 2 + 5;
-    int highDegX = x + dx - spacing + canvas.textWidth(highTemp) / 2 + 5;
-    int degY = tempTextY + 1;
+    displayList.setTextDatum(TL_DATUM);
+}
 
-    drawDegreeSymbol(lowDegX, degY, TODAY_TEMP_DEGREE_RADIUS);
-    drawDegreeSymbol(highDegX, degY, TODAY_TEMP_DEGREE_RADIUS);
+void drawSunInfoChrome(int x, int y, int dx, int dy) {
+    drawPanelTitle(x, y, dx, "Sun & Moon");
+    drawIcon(x + 25, y + 50, IMAGE_SUNRISE);
+    drawIcon(x + 25, y + 125, IMAGE_SUNSET);
+}
 
-    canvas.setTextDatum(TL_DATUM);
+// Next moonrise or moonset after the given minute of today, or ASTRO_NONE
+static int nextMoonEvent(const AstroDay &astro, int minute, bool &rising) {
+    int next = ASTRO_NONE;
+    if (astro.moonrise > minute) {
+        next = astro.moonrise;
+        rising = true;
+    }
+    if (astro.moonset > minute && (next == ASTRO_NONE || astro.moonset < next)) {
+        next = astro.moonset;
+        rising = false;
+    }
+    return next;
 }
 
 void drawSunInfo(int x, int y, int dx, int dy) {
-    canvas.setTextSize(3);
-    canvas.setTextDatum(TC_DATUM);
-    canvas.drawString("Sun & Moon", x + dx / 2, y + 7);
-    canvas.setTextDatum(TL_DATUM);
-    canvas.drawLine(x, y + PANEL_TITLE_HEIGHT, x + dx, y + PANEL_TITLE_HEIGHT, TFT_BLACK);
-
-    // Draw sunrise
-    canvas.setTextSize(3);
-    drawIcon(x + 25, y + 50, SUNRISE64x64, WEATHER_ICON_SIZE, WEATHER_ICON_SIZE, false);
-    if (currentWeather.sunriseTime.length() > 0) {
-        canvas.drawString(currentWeather.sunriseTime, x + 100, y + 75);
-    }
+    const AstroDay &astro = astroToday();
+    char timeStr[8];
 
-    // Draw sunset
-    drawIcon(x + 25, y + 125, SUNSET64x64, WEATHER_ICON_SIZE, WEATHER_ICON_SIZE, false);
-    if (currentWeather.sunsetTime.length() > 0) {
-        canvas.drawString(currentWeather.sunsetTime, x + 100, y + 150);
-    }
+    // Draw sunrise and sunset
+    displayList.setTextSize(3);
+    displayList.drawString(formatMinutes(timeStr, sizeof(timeStr), astro.sunrise), x + 100, y + 75);
+    displayList.drawString(formatMinutes(timeStr, sizeof(timeStr), astro.sunset), x + 100, y + 150);
 
-    // Draw moon phase
-    float moonPhase = getMoonPhase();
-    canvas.setTextSize(2);
-    canvas.setTextDatum(TC_DATUM);
-    String phaseText = "";
-    if (moonPhase < MOON_PHASE_NEW_MIN || moonPhase > MOON_PHASE_NEW_MAX) phaseText = "New";
-    else if (moonPhase < MOON_PHASE_WAXING_CRES) phaseText = "Waxing Cres";
-    else if (moonPhase < MOON_PHASE_FIRST_QTR) phaseText = "First Qtr";
-    else if (moonPhase < MOON_PHASE_WAXING_GIB) phaseText = "Waxing Gib";
-    else if (moonPhase < MOON_PHASE_FULL) phaseText = "Full";
-    else if (moonPhase < MOON_PHASE_WANING_GIB) phaseText = "Waning Gib";
-    else if (moonPhase < MOON_PHASE_LAST_QTR) phaseText = "Last Qtr";
-    else phaseText = "Waning Cres";
+    // Draw moon phase, illumination and the next moonrise or moonset
+    char moonStr[24];
+    snprintf(moonStr, sizeof(moonStr), "Moon: %s", getMoonPhaseName(astro.moonPhase / 1000.0f));
+    displayList.setTextSize(2);
+    displayList.setTextDatum(TC_DATUM);
+    displayList.drawString(moonStr, x + dx / 2, y + 200);
 
-    canvas.drawString("Moon: " + phaseText, x + dx / 2, y + 210);
-    canvas.setTextDatum(TL_DATUM);
+    struct tm timeinfo;
+    bool rising = false;
+    int next = getLocalTime(&timeinfo) ? nextMoonEvent(astro, timeinfo.tm_hour * 60 + timeinfo.tm_min, rising)
+                                          : ASTRO_NONE;
+    if (next != ASTRO_NONE) {
+        snprintf(moonStr, sizeof(moonStr), "%u%%  %s %s", astro.moonIllumination, rising ? "Rise" : "Set",
+                 formatMinutes(timeStr, sizeof(timeStr), next));
+    } else {
+        snprintf(moonStr, sizeof(moonStr), "%u%% lit", astro.moonIllumination);
+    }
+    displayList.drawString(moonStr, x + dx / 2, y + 224);
+    displayList.setTextDatum(TL_DATUM);
 }
 
-void drawWindInfo(int x, int y, int dx, int dy) {
-    canvas.setTextSize(3);
-    canvas.drawString("Wind", x + dx / 2 - 40, y + 7);
-    canvas.drawLine(x, y + PANEL_TITLE_HEIGHT, x + dx, y + PANEL_TITLE_HEIGHT, TFT_BLACK);
+void drawWindInfoChrome(int x, int y, int dx, int dy) {
+    displayList.setTextSize(3);
+    displayList.drawString("Wind", x + dx / 2 - 40, y + 7);
+    displayList.drawLine(x, y + PANEL_TITLE_HEIGHT, x + dx, y + PANEL_TITLE_HEIGHT, TFT_BLACK);
 
-    drawWindCompass(x + dx / 2, y + dy / 2 + 20, currentWeather.windDir, currentWeather.windSpeed, COMPASS_RADIUS);
+    drawWindCompassChrome(x + dx / 2, y + dy / 2 + 20, COMPASS_RADIUS);
 }
 
-void drawM5PaperInfo(int x, int y, int dx, int dy) {
-    canvas.setTextSize(3);
-    canvas.setTextDatum(TC_DATUM);
-    canvas.drawString("M5Paper S3", x + dx / 2, y + 7);
-    canvas.setTextDatum(TL_DATUM);
-    canvas.drawLine(x, y + PANEL_TITLE_HEIGHT, x + dx, y + PANEL_TITLE_HEIGHT, TFT_BLACK);
+void drawWindInfo(int x, int y, int dx, int dy) {
+    drawWindCompass(x + dx / 2, y + dy / 2 + 20, currentWeather.windDir,
+                   fromFixed(currentWeather.windSpeed, SPEED_SCALE), COMPASS_RADIUS);
+}
 
-    // Draw date and time
+void drawClockRegion(int x, int y, int dx, int dy) {
     struct tm timeinfo;
-    if (getLocalTime(&timeinfo)) {
-        char dateStr[16], timeStr[16];
-        sprintf(dateStr, "%02d.%02d.%04d", timeinfo.tm_mday, timeinfo.tm_mon + 1, timeinfo.tm_year + 1900);
-        sprintf(timeStr, "%02d:%02d:%02d", timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
-
-        canvas.setTextSize(3);
-        canvas.setTextDatum(TC_DATUM);
-        canvas.drawString(dateStr, x + dx / 2, y + 55);
-        canvas.drawString(timeStr, x + dx / 2, y + 95);
-        canvas.setTextDatum(TL_DATUM);
-
-        canvas.setTextSize(2);
-        canvas.setTextDatum(TC_DATUM);
-        canvas.drawString("updated", x + dx / 2, y + 120);
-        canvas.setTextDatum(TL_DATUM);
+    if (!getLocalTime(&timeinfo)) {
+        return;
+    }
+
+    char dateStr[16], timeStr[16];
+    sprintf(dateStr, "%02d.%02d.%04d", timeinfo.tm_mday, timeinfo.tm_mon + 1, timeinfo.tm_year + 1900);
+    sprintf(timeStr, "%02d:%02d", timeinfo.tm_hour, timeinfo.tm_min);
+
+    displayList.setTextSize(3);
+    displayList.setTextDatum(TC_DATUM);
+    displayList.drawString(dateStr, x + dx / 2, y + 15);
+    displayList.drawString(timeStr, x + dx / 2, y + 55);
+
+    // Data age: how long ago the weather shown on screen was fetched
+    char ageStr[24];
+    long age = (lastFetchTime > 0) ? (long)(time(nullptr) - lastFetchTime) / 60 : -1;
+    if (age < 0) {
+        sprintf(ageStr, "not updated");
+    } else if (age == 0) {
+        sprintf(ageStr, "updated now");
+    } else if (age < 60) {
+        sprintf(ageStr, "updated %ldm ago", age);
+    } else {
+        sprintf(ageStr, "updated %ldh ago", age / 60);
     }
 
+    displayList.setTextSize(2);
+    displayList.drawString(ageStr, x + dx / 2, y + 80);
+    displayList.setTextDatum(TL_DATUM);
+}
+
+void drawM5PaperInfoChrome(int x, int y, int dx, int dy) {
+    drawPanelTitle(x, y, dx, "M5Paper S3");
+}
+
+void drawSensorInfoChrome(int x, int y, int dx, int dy) {
+    drawIcon(x + 35, y + 2, IMAGE_TEMPERATURE);
+    drawIcon(x + 145, y + 2, IMAGE_HUMIDITY);
+}
+
+void drawSensorInfo(int x, int y, int dx, int dy) {
     // Draw internal temperature and humidity
     float sensorTemp = readInternalTemperature();
     float sensorHumid = readInternalHumidity();
 
-    float displayTemp = (sensorTemp > SENSOR_ERROR_VALUE) ? sensorTemp : currentWeather.temperature;
+    float displayTemp = (sensorTemp > SENSOR_ERROR_VALUE) ? sensorTemp : fromFixed(currentWeather.temperature, TEMP_SCALE);
     float displayHumid = (sensorHumid > SENSOR_ERROR_VALUE) ? sensorHumid : currentWeather.humidity;
 
-    canvas.setTextSize(3);
-    drawIcon(x + 35, y + 140, TEMPERATURE64x64, WEATHER_ICON_SIZE, WEATHER_ICON_SIZE, false);
-    canvas.drawString(formatTemp(displayTemp), x + 35, y + 210);
-
-    drawIcon(x + 145, y + 140, HUMIDITY64x64, WEATHER_ICON_SIZE, WEATHER_ICON_SIZE, false);
-    canvas.drawString(String((int)displayHumid) + "%", x + 150, y + 210);
+    char text[12];
+    displayList.setTextSize(3);
+    displayList.drawString(formatTemp(text, sizeof(text), displayTemp), x + 35, y + 72);
+    displayList.drawString(formatPercent(text, sizeof(text), (int)displayHumid), x + 150, y + 72);
 }
 
-void displayWeather() {
-    M5.Display.startWrite();
-
-    if (!canvas.createSprite(SCREEN_WIDTH, SCREEN_HEIGHT)) {
-        Serial.println("ERROR: Failed to allocate canvas memory!");
-        M5.Display.endWrite();
-        return;
-    }
-
-    canvas.fillSprite(TFT_WHITE);
-    canvas.setTextColor(TFT_BLACK, TFT_WHITE);
-    canvas.setTextDatum(TL_DATUM);
-    canvas.setTextSize(2);
+void drawHeaderChrome(int x, int y, int dx, int dy) {
+    displayList.setTextSize(2);
+    displayList.drawString(VERSION, x + 20, y + 10);
+}
 
-    // Draw header
-    canvas.setTextSize(2);
-    canvas.drawString(VERSION, 20, 10);
-    canvas.setTextDatum(TC_DATUM);
-    canvas.drawString(cityName, SCREEN_WIDTH / 2, 10);
-    canvas.setTextDatum(TL_DATUM);
+void drawHeader(int x, int y, int dx, int dy) {
+    // Draw city name
+    displayList.setTextSize(2);
+    displayList.setTextDatum(TC_DATUM);
+    displayList.drawString(config.city, x + dx / 2, y + 10);
+    displayList.setTextDatum(TL_DATUM);
 
     // Draw WiFi signal strength
-    int rssi = WiFi.RSSI();
+    char text[8];
+    int rssi = currentWeather.rssi;
     int quality = getRSSIQuality(rssi);
-    canvas.setTextDatum(TR_DATUM);
-    canvas.drawString(String(quality) + "%", SCREEN_WIDTH - 153, 10);
-    canvas.setTextDatum(TL_DATUM);
-    drawRSSI(SCREEN_WIDTH - 147, 23, rssi);
+    displayList.setTextDatum(TR_DATUM);
+    displayList.drawString(formatPercent(text, sizeof(text), quality), x + dx - 153, y + 10);
+    displayList.setTextDatum(TL_DATUM);
+    drawRSSI(x + dx - 147, y + 23, rssi);
 
     // Draw battery level
     int batteryPercent = M5.Power.getBatteryLevel();
     if (batteryPercent < 0) batteryPercent = 0;
     if (batteryPercent > 100) batteryPercent = 100;
 
-    canvas.setTextDatum(TR_DATUM);
-    canvas.drawString(String(batteryPercent) + "%", SCREEN_WIDTH - 71, 10);
-    canvas.setTextDatum(TL_DATUM);
-    drawBattery(SCREEN_WIDTH - 60, 10, batteryPercent);
+    displayList.setTextDatum(TR_DATUM);
+    displayList.drawString(formatPercent(text, sizeof(text), batteryPercent), x + dx - 71, y + 10);
+    displayList.setTextDatum(TL_DATUM);
+    drawBattery(x + dx - 60, y + 10, batteryPercent);
+}
+
+void drawConfigButtonChrome(int x, int y, int dx, int dy) {
+    displayList.setTextSize(1);
+    displayList.drawString("[CFG]", x + dx - 50, y);
+}
+
+// Static dispatch over LAYOUT: each panel's draw calls are resolved at compile
+// time. Panels record at their screen position, tagged with their PanelId.
+template <size_t I>
+static void drawPanelChrome() {
+    constexpr PanelLayout panel = LAYOUT[I];
+    if constexpr (panel.chrome != nullptr) {
+        displayList.setPanel(panel.id);
+        displayList.setTextColor(TFT_BLACK, TFT_WHITE);
+        displayList.setTextDatum(TL_DATUM);
+        panel.chrome(panel.rect.x, panel.rect.y, panel.rect.w, panel.rect.h);
+    }
+}
+
+template <size_t I>
+static void drawPanelContent(uint16_t mask) {
+    constexpr PanelLayout panel = LAYOUT[I];
+    if constexpr (panel.draw != nullptr) {
+        if (mask & panelBit(panel.id)) {
+            displayList.setPanel(panel.id);
+            displayList.setTextColor(TFT_BLACK, TFT_WHITE);
+            displayList.setTextDatum(TL_DATUM);
+            panel.draw(panel.rect.x, panel.rect.y, panel.rect.w, panel.rect.h);
+        }
+    }
+}
+
+template <size_t... I>
+static void drawLayoutChrome(std::index_sequence<I...>) {
+    (drawPanelChrome<I>(), ...);
+}
+
+template <size_t... I>
+static void drawLayoutContent(uint16_t mask, std::index_sequence<I...>) {
+    (drawPanelContent<I>(mask), ...);
+}
+
+// Record one panel (chrome and content), replay it into a panel-sized sprite and push it
+template <size_t I>
+static void updatePanel(uint16_t mask) {
+    constexpr PanelLayout panel = LAYOUT[I];
+    if (!(mask & panelBit(panel.id))) return;
 
-    // Draw config button indicator
-    canvas.setTextSize(1);
-    canvas.drawString("[CFG]", SCREEN_WIDTH - 50, SCREEN_HEIGHT - 20);
+    if (!canvas.createSprite(panel.rect.w, panel.rect.h)) {
+        Serial.printf("ERROR: Failed to allocate canvas for panel %d!\n", (int)panel.id);
+        return;
+    }
+    displayList.clear();
+    drawPanelChrome<I>();
+    drawPanelContent<I>(mask);
+
+    canvas.fillSprite(TFT_WHITE);
+    rasteriseDisplayList(displayList, canvas, panel.rect.x, panel.rect.y);
+    canvas.pushSprite(panel.rect.x, panel.rect.y);
+    patchFrameSnapshot((const uint8_t *)canvas.getBuffer(), panel.rect.x, panel.rect.y, panel.rect.w, panel.rect.h);
+    canvas.deleteSprite();
+}
+
+template <size_t... I>
+static void updatePanels(uint16_t mask, std::index_sequence<I...>) {
+    (updatePanel<I>(mask), ...);
+}
+
+// Everything that only changes with firmware, layout or unit setting
+void drawStaticLayer() {
+    displayList.setPanel(PANEL_NONE);
 
     // Draw main border
-    canvas.drawRect(PANEL_BORDER, HEADER_HEIGHT, SCREEN_WIDTH - 28, SCREEN_HEIGHT - 43, TFT_BLACK);
+    displayList.drawRect(PANEL_BORDER, HEADER_HEIGHT, SCREEN_WIDTH - 28, SCREEN_HEIGHT - 43, TFT_BLACK);
+
+    // Draw top row frame and column separators
+    displayList.drawRect(ROW_X, TOP_ROW_Y, ROW_WIDTH, TOP_ROW_HEIGHT, TFT_BLACK);
+    for (PanelId id : { PANEL_WIND, PANEL_SUN, PANEL_INFO_TITLE }) {
+        int x = LAYOUT[id].rect.x;
+        displayList.drawLine(x, TOP_ROW_Y, x, HOURLY_ROW_Y, TFT_BLACK);
+    }
+
+    drawLayoutChrome(std::make_index_sequence<PANEL_COUNT>());
+}
 
-    // Draw top row panels (Current, Wind, Sun, M5Paper Info)
-    canvas.drawRect(PANEL_SPACING, PANEL_TITLE_HEIGHT, SCREEN_WIDTH - 30, 251, TFT_BLACK);
-    canvas.drawLine(232, PANEL_TITLE_HEIGHT, 232, 286, TFT_BLACK);
-    canvas.drawLine(465, PANEL_TITLE_HEIGHT, 465, 286, TFT_BLACK);
-    canvas.drawLine(697, PANEL_TITLE_HEIGHT, 697, 286, TFT_BLACK);
+// Screen areas that differ from the frame on the glass: the changed commands
+// plus the panels micro-wakes may have redrawn since the stored list was
+// recorded (their pixels are patched into the snapshot, the list is not).
+// Returns -1 if everything has to be pushed.
+static int changedRegions(DrawBounds *rects) {
+    constexpr uint16_t stale = panelsInvalidatedBy(DATA_CLOCK, DATA_OFFLINE);
+    const int staleCount = __builtin_popcount(stale);
+
+    if (previousList.size() == 0) return -1;
+    int count = diffDisplayLists(previousList, displayList, rects, MAX_DIRTY_RECTS - staleCount);
+    if (count < 0) return -1;
+
+    for (const PanelLayout &panel : LAYOUT) {
+        if (stale & panelBit(panel.id)) {
+            rects[count++] = { panel.rect.x, panel.rect.y, panel.rect.w, panel.rect.h };
+        }
+    }
+    return count;
+}
 
-    drawCurrentConditions(PANEL_SPACING, PANEL_TITLE_HEIGHT, 217, 251);
-    drawWindInfo(232, PANEL_TITLE_HEIGHT, 233, 251);
-    drawSunInfo(465, PANEL_TITLE_HEIGHT, 232, 251);
-    drawM5PaperInfo(697, PANEL_TITLE_HEIGHT, 245, 251);
+static void recordContent() {
+    displayList.clear();
+    drawLayoutContent(ALL_PANELS, std::make_index_sequence<PANEL_COUNT>());
+    if (displayList.overflowed()) {
+        Serial.println("WARNING: Display list full, frame is incomplete");
+    }
+}
 
-    // Draw hourly forecast row
-    canvas.drawRect(PANEL_SPACING, 286, SCREEN_WIDTH - 30, 122, TFT_BLACK);
-    for (int i = 0; i < MAX_HOURLY; i++) {
-        int x = PANEL_SPACING + i * 116;
-        canvas.drawLine(x, 286, x, 408, TFT_BLACK);
-        drawHourlyForecast(x, 286, 116, 122, i);
+// Push a canvas placed at (x, y), clipped to the changed regions (count < 0: all of it)
+static void pushChanged(M5Canvas &source, int x, int y, const DrawBounds *rects, int count) {
+    if (count < 0) {
+        source.pushSprite(x, y);
+        return;
     }
+    for (int i = 0; i < count; i++) {
+        if (rects[i].y >= y + source.height() || rects[i].y + rects[i].h <= y) continue;
+        M5.Display.setClipRect(rects[i].x, rects[i].y, rects[i].w, rects[i].h);
+        source.pushSprite(x, y);
+    }
+    M5.Display.clearClipRect();
+}
+
+static void logPush(int count) {
+    if (count < 0) {
+        Serial.printf("Display list: %u bytes, pushed full screen\n", (unsigned)displayList.size());
+    } else {
+        Serial.printf("Display list: %u bytes, pushed %d changed regions\n", (unsigned)displayList.size(), count);
+    }
+}
 
-    // Draw graphs row
-    canvas.drawRect(PANEL_SPACING, 408, SCREEN_WIDTH - 30, 122, TFT_BLACK);
+// Full-screen canvas holding the static layer, between prepareFrame() and displayWeather()
+static bool framePrepared = false;
+static bool chromeRebuilt = false;
+
+bool prepareFrame() {
+    if (framePrepared) return true;
+    if (!canvas.createSprite(SCREEN_WIDTH, SCREEN_HEIGHT)) return false;
+
+    // Start from the cached static layer; render and cache it if it is stale
+    chromeRebuilt = !loadChromeLayer();
+    if (chromeRebuilt) {
+        displayList.clear();
+        drawStaticLayer();
+        canvas.fillSprite(TFT_WHITE);
+        rasteriseDisplayListParallel(displayList, canvas);
+        saveChromeLayer();
+    }
 
-    float hourlyUVArray[MAX_HOURLY];
-    float hourlyPrecipArray[MAX_HOURLY];
-    float hourlyHumidityArray[MAX_HOURLY];
-    float hourlyPressureArray[MAX_HOURLY];
+    // Everything the render allocates, so displayWeather() itself does not touch the heap
+    prepareParallelRaster(canvas);
+    reserveFrameSnapshot();
+    framePrepared = true;
+    return true;
+}
 
-    for (int i = 0; i < MAX_HOURLY; i++) {
-        hourlyUVArray[i] = currentWeather.hourly[i].uvIndex;
-        hourlyPrecipArray[i] = currentWeather.hourly[i].precip;
-        hourlyHumidityArray[i] = currentWeather.hourly[i].humidity;
-        hourlyPressureArray[i] = currentWeather.hourly[i].pressure;
+// Render into the full-screen canvas set up by prepareFrame()
+static void renderFullFrame(bool fullRefresh) {
+    recordContent();
+    rasteriseDisplayListParallel(displayList, canvas);
+
+    // Push only what changed since the frame on the glass, unless the whole
+    // screen has to be driven anyway
+    DrawBounds rects[MAX_DIRTY_RECTS];
+    int count = (fullRefresh || chromeRebuilt) ? -1 : changedRegions(rects);
+    pushChanged(canvas, 0, 0, rects, count);
+    logPush(count);
+}
+
+// Fallback when the full-screen canvas cannot be allocated: replay the same
+// display lists into one BAND_HEIGHT-row sprite in internal SRAM, top to
+// bottom. Output is identical to renderFullFrame(); the snapshot is encoded
+// band by band. Returns false if even the band cannot be allocated.
+static bool renderBands(bool fullRefresh) {
+    bandCanvas.setColorDepth(CANVAS_COLOR_DEPTH);
+    bandCanvas.setPsram(false);
+    if (!bandCanvas.createSprite(SCREEN_WIDTH, BAND_HEIGHT)) return false;
+
+    // A stale chrome cache cannot be rebuilt without a full canvas, so keep the
+    // chrome as a list. The previous frame's list is only needed for diffing,
+    // which a changed chrome rules out anyway.
+    bool chromeCached = chromeLayerValid();
+    DisplayList &chromeList = previousList;
+    if (!chromeCached) {
+        displayList.clear();
+        drawStaticLayer();
+        chromeList.assign(displayList.data(), displayList.size());
     }
 
-    drawGraph(PANEL_SPACING, 408, 232, 122, "UV Index", 0, 7, 0, 12, hourlyUVArray);
-    drawGraph(247, 408, 232, 122, "Precip (%)", 0, 7, 0, 100, hourlyPrecipArray);
-    drawGraph(479, 408, 232, 122, "Humidity (%)", 0, 7, 0, 100, hourlyHumidityArray);
-    drawGraph(711, 408, 232, 122, "Pressure (hPa)", 0, 7, 980, 1040, hourlyPressureArray);
+    recordContent();
 
-    // Push to display
-    canvas.pushSprite(0, 0);
-    canvas.deleteSprite();
+    DrawBounds rects[MAX_DIRTY_RECTS];
+    int count = (fullRefresh || !chromeCached) ? -1 : changedRegions(rects);
+    bool snapshot = beginFrameSnapshot();
+    uint8_t *band = (uint8_t *)bandCanvas.getBuffer();
+
+    for (int y = 0; y < SCREEN_HEIGHT; y += BAND_HEIGHT) {
+        int rows = min(BAND_HEIGHT, SCREEN_HEIGHT - y);
+        if (!chromeCached || !loadChromeRows(band, y, rows)) {
+            bandCanvas.fillSprite(TFT_WHITE);
+            rasteriseDisplayList(chromeList, bandCanvas, 0, y);
+        }
+        rasteriseDisplayList(displayList, bandCanvas, 0, y);
+        pushChanged(bandCanvas, 0, y, rects, count);
+        if (snapshot) appendFrameSnapshotRows(band, rows);
+    }
+
+    bandCanvas.deleteSprite();
+    logPush(count);
+    return true;
+}
+
+void displayWeather() {
+    // With the previous frame known to the driver a partial refresh is enough;
+    // every few refreshes do a full-quality one to clear accumulated ghosting
+    bool fullRefresh = !frameRestored || refreshCounter >= FULL_REFRESH_INTERVAL;
+    setWaveform(fullRefresh ? epd_mode_t::epd_quality : PARTIAL_REFRESH_MODE);
+    refreshCounter = fullRefresh ? 0 : refreshCounter + 1;
+    Serial.printf("EPD refresh: %s (%d/%d)\n", fullRefresh ? "full" : "partial",
+                  refreshCounter, FULL_REFRESH_INTERVAL);
+
+    bool banded = !prepareFrame();
+    AllocationCheck allocations("displayWeather()", !banded);
+    M5.Display.startWrite();
 
+    if (!banded) {
+        renderFullFrame(fullRefresh);
+    } else {
+        Serial.printf("Full-screen canvas unavailable, rendering in %d-row bands\n", BAND_HEIGHT);
+        if (!renderBands(fullRefresh)) {
+            Serial.println("ERROR: Failed to allocate canvas memory!");
+            M5.Display.endWrite();
+            return;
+        }
+    }
+
+    M5.Display.endWrite();
+    M5.Display.display();
+
+    // Snapshot while the EPD runs its waveform so the next boot can update partially
+    if (banded) {
+        finishFrameSnapshot();
+    } else {
+        saveFrameSnapshot();
+        canvas.deleteSprite();
+        framePrepared = false;
+    }
+}
+
+void showSplashScreen() {
+    M5.Display.startWrite();
+    M5.Display.fillScreen(TFT_WHITE);
+    M5.Display.setTextColor(TFT_BLACK);
+    M5.Display.setTextSize(2);
+    M5.Display.setCursor(20, 20);
+    M5.Display.println("PaperS3Weather " + String(VERSION));
+    M5.Display.setCursor(20, 50);
+    M5.Display.println("Initializing...");
+    M5.Display.endWrite();
+    M5.Display.display();
+
+    Serial.println("Splash screen displayed");
+}
+
+void displayPanelUpdate(uint16_t panels) {
+    M5.Display.startWrite();
+    updatePanels(panels, std::make_index_sequence<PANEL_COUNT>());
     M5.Display.endWrite();
     M5.Display.display();
 }
+
+void displayClockUpdate() {
+    // Only the clock region changes, so a fast waveform is good enough
+    setWaveform(epd_mode_t::epd_fast);
+    displayPanelUpdate(panelsInvalidatedBy(DATA_CLOCK, DATA_OFFLINE));
+}
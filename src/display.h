@@ -3,26 +3,59 @@
 
 #include <M5Unified.h>
 #include <M5GFX.h>
+#include "icon_images.h"
 
 // Main display function
 void displayWeather();
 
-// Panel drawing functions
+// Allocate the full-screen canvas and fill it with the static layer, so this
+// part of the frame can be done before the weather data arrives. Called by
+// displayWeather() if it has not run yet; false if the canvas does not fit.
+bool prepareFrame();
+
+// "Initializing..." screen for boots without a restored frame
+void showSplashScreen();
+
+// Record the static chrome layer (borders, titles, compass rose, graph frames,
+// fixed icons) into the display list
+void drawStaticLayer();
+
+// Redraw only the given panels (bit mask of PanelId, see layout.h)
+void displayPanelUpdate(uint16_t panels);
+
+// Micro-wake: redraw only the clock region with a fast partial update
+void displayClockUpdate();
+
+// Panel drawing functions (the *Chrome variants draw the static parts). All
+// drawing below records into the display list at screen coordinates.
+void drawPanelTitle(int x, int y, int dx, const char *title);
+void drawHeaderChrome(int x, int y, int dx, int dy);
+void drawHeader(int x, int y, int dx, int dy);
+void drawCurrentConditionsChrome(int x, int y, int dx, int dy);
 void drawCurrentConditions(int x, int y, int dx, int dy);
+void drawSunInfoChrome(int x, int y, int dx, int dy);
 void drawSunInfo(int x, int y, int dx, int dy);
+void drawWindInfoChrome(int x, int y, int dx, int dy);
 void drawWindInfo(int x, int y, int dx, int dy);
-void drawM5PaperInfo(int x, int y, int dx, int dy);
-void drawHourlyForecast(int x, int y, int dx, int dy, int index);
-
-// Graph drawing functions
-void drawGraph(int x, int y, int dx, int dy, String title, int xMin, int xMax, float yMin, float yMax, float values[]);
-void drawTempGraph(int x, int y, int dx, int dy, String title, int xMin, int xMax, float yMin, float yMax, float highValues[], float lowValues[]);
+void drawM5PaperInfoChrome(int x, int y, int dx, int dy);
+void drawClockRegion(int x, int y, int dx, int dy);
+void drawSensorInfoChrome(int x, int y, int dx, int dy);
+void drawSensorInfo(int x, int y, int dx, int dy);
+void drawHourlyRowChrome(int x, int y, int dx, int dy);
+void drawHourlyRow(int x, int y, int dx, int dy);
+void drawHourlyForecast(int x, int y, int dx, int dy, int slot);
+void drawGraphRowChrome(int x, int y, int dx, int dy);
+void drawGraphRow(int x, int y, int dx, int dy);
+void drawConfigButtonChrome(int x, int y, int dx, int dy);
 
 // Component drawing functions
-void drawIcon(int x, int y, const uint8_t *icon, int dx = 64, int dy = 64, bool highContrast = false);
+void drawIcon(int x, int y, IconImage image, IconDepth depth = ICON_GRAY4);
 void drawRSSI(int x, int y, int rssi);
 void drawBattery(int x, int y, int batteryPercent);
 void drawArrow(int x, int y, int asize, float aangle, int pwidth, int plength);
+void drawArcPixels(int cx, int cy, int r, int fromDeg, int toDeg, uint32_t color);
+void fillRotatedPolygon(int cx, int cy, const int16_t points[][2], int count, int32_t deci, uint32_t color);
+void drawWindCompassChrome(int x, int y, int radius);
 void drawWindCompass(int x, int y, float angle, float windspeed, int radius);
 
 #endif // DISPLAY_H
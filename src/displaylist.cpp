@@ -0,0 +1,329 @@
+#include "displaylist.h"
+#include <string.h>
+
+// Records are padded so every header stays 4-byte aligned
+#define RECORD_ALIGN 4
+#define BUILTIN_FONT_WIDTH 6
+
+static inline int imin(int a, int b) { return a < b ? a : b; }
+static inline int imax(int a, int b) { return a > b ? a : b; }
+
+// Payloads are compared and persisted byte for byte, so their padding must
+// not carry stack garbage: zero the whole struct before setting the fields
+template <typename T>
+static inline void zeroFill(T &payload) {
+    memset(&payload, 0, sizeof(payload));
+}
+
+static DrawBounds boundsOf(int x0, int y0, int x1, int y1) {
+    DrawBounds b;
+    b.x = imin(x0, x1);
+    b.y = imin(y0, y1);
+    b.w = imax(x0, x1) - b.x + 1;
+    b.h = imax(y0, y1) - b.y + 1;
+    return b;
+}
+
+DisplayList::DisplayList(uint8_t *arena, size_t capacity)
+    : arena(arena), cap(capacity), used(0), overflow(false), currentPanel(0),
+      textSize(1), textDatum(0), textColor(0), textBackground(0) {
+}
+
+void DisplayList::clear() {
+    used = 0;
+    overflow = false;
+    currentPanel = 0;
+    textSize = 1;
+    textDatum = 0;
+}
+
+bool DisplayList::assign(const uint8_t *bytes, size_t length) {
+    clear();
+    if (length > cap) return false;
+
+    // Walk the records once so iteration never runs off the end
+    size_t offset = 0;
+    while (offset < length) {
+        if (length - offset < sizeof(DrawCommand)) return false;
+        uint16_t size;
+        memcpy(&size, bytes + offset + offsetof(DrawCommand, size), sizeof(size));
+        if (size < sizeof(DrawCommand) || size % RECORD_ALIGN || size > length - offset) return false;
+        offset += size;
+    }
+
+    memcpy(arena, bytes, length);
+    used = length;
+    return true;
+}
+
+const DrawCommand *DisplayList::next(const DrawCommand *cmd) const {
+    const uint8_t *p = (const uint8_t *)cmd + cmd->size;
+    return p < arena + used ? (const DrawCommand *)p : nullptr;
+}
+
+uint8_t *DisplayList::record(DrawOp op, const DrawBounds &bounds, const void *fixed, size_t fixedSize, size_t extra) {
+    size_t size = (sizeof(DrawCommand) + fixedSize + extra + RECORD_ALIGN - 1) & ~(size_t)(RECORD_ALIGN - 1);
+    if (overflow || size > UINT16_MAX || used + size > cap) {
+        overflow = true;
+        return nullptr;
+    }
+
+    uint8_t *p = arena + used;
+    DrawCommand header;
+    zeroFill(header);
+    header.op = op;
+    header.panel = currentPanel;
+    header.size = size;
+    header.bounds = bounds;
+    memcpy(p, &header, sizeof(header));
+    memcpy(p + sizeof(header), fixed, fixedSize);
+    // Zero the padding so identical commands compare equal byte for byte
+    memset(p + sizeof(header) + fixedSize, 0, size - sizeof(header) - fixedSize);
+    used += size;
+    return p + sizeof(header) + fixedSize;
+}
+
+int DisplayList::textWidth(const char *text) const {
+    return (int)strlen(text) * BUILTIN_FONT_WIDTH * textSize;
+}
+
+void DisplayList::drawString(const char *text, int x, int y) {
+    int w = textWidth(text);
+    int h = fontHeight();
+
+    // Same anchor rules as LovyanGFX text datums
+    DrawBounds b;
+    b.x = x - ((textDatum & 3) == 1 ? w / 2 : (textDatum & 3) == 2 ? w : 0);
+    b.y = y - ((textDatum & 12) == 4 ? h / 2 : (textDatum & 24) ? h : 0);
+    b.w = w;
+    b.h = h;
+
+    TextPayload t;
+    zeroFill(t);
+    t.x = (int16_t)x;
+    t.y = (int16_t)y;
+    t.color = textColor;
+    t.background = textBackground;
+    t.size = textSize;
+    t.datum = textDatum;
+    size_t length = strlen(text) + 1;
+    uint8_t *tail = record(OP_TEXT, b, &t, sizeof(t), length);
+    if (tail) memcpy(tail, text, length);
+}
+
+void DisplayList::drawLine(int x0, int y0, int x1, int y1, uint32_t color) {
+    LinePayload l;
+    zeroFill(l);
+    l.x0 = (int16_t)x0;
+    l.y0 = (int16_t)y0;
+    l.x1 = (int16_t)x1;
+    l.y1 = (int16_t)y1;
+    l.color = color;
+    record(OP_LINE, boundsOf(x0, y0, x1, y1), &l, sizeof(l), 0);
+}
+
+void DisplayList::drawRect(int x, int y, int w, int h, uint32_t color) {
+    if (w <= 0 || h <= 0) return;
+    RectPayload r;
+    zeroFill(r);
+    r.x = (int16_t)x;
+    r.y = (int16_t)y;
+    r.w = (int16_t)w;
+    r.h = (int16_t)h;
+    r.color = color;
+    record(OP_RECT, boundsOf(x, y, x + w - 1, y + h - 1), &r, sizeof(r), 0);
+}
+
+void DisplayList::fillRect(int x, int y, int w, int h, uint32_t color) {
+    if (w <= 0 || h <= 0) return;
+    RectPayload r;
+    zeroFill(r);
+    r.x = (int16_t)x;
+    r.y = (int16_t)y;
+    r.w = (int16_t)w;
+    r.h = (int16_t)h;
+    r.color = color;
+    record(OP_FILL_RECT, boundsOf(x, y, x + w - 1, y + h - 1), &r, sizeof(r), 0);
+}
+
+void DisplayList::drawCircle(int x, int y, int r, uint32_t color) {
+    CirclePayload c;
+    zeroFill(c);
+    c.x = (int16_t)x;
+    c.y = (int16_t)y;
+    c.r = (int16_t)r;
+    c.color = color;
+    record(OP_CIRCLE, boundsOf(x - r, y - r, x + r, y + r), &c, sizeof(c), 0);
+}
+
+void DisplayList::fillCircle(int x, int y, int r, uint32_t color) {
+    CirclePayload c;
+    zeroFill(c);
+    c.x = (int16_t)x;
+    c.y = (int16_t)y;
+    c.r = (int16_t)r;
+    c.color = color;
+    record(OP_FILL_CIRCLE, boundsOf(x - r, y - r, x + r, y + r), &c, sizeof(c), 0);
+}
+
+void DisplayList::fillTriangle(int x0, int y0, int x1, int y1, int x2, int y2, uint32_t color) {
+    TrianglePayload t;
+    zeroFill(t);
+    t.x0 = (int16_t)x0;
+    t.y0 = (int16_t)y0;
+    t.x1 = (int16_t)x1;
+    t.y1 = (int16_t)y1;
+    t.x2 = (int16_t)x2;
+    t.y2 = (int16_t)y2;
+    t.color = color;
+    DrawBounds b = boundsOf(imin(x0, imin(x1, x2)), imin(y0, imin(y1, y2)),
+                            imax(x0, imax(x1, x2)), imax(y0, imax(y1, y2)));
+    record(OP_FILL_TRIANGLE, b, &t, sizeof(t), 0);
+}
+
+void DisplayList::drawPixel(int x, int y, uint32_t color) {
+    PixelPayload p;
+    zeroFill(p);
+    p.x = (int16_t)x;
+    p.y = (int16_t)y;
+    p.color = color;
+    record(OP_PIXEL, boundsOf(x, y, x, y), &p, sizeof(p), 0);
+}
+
+void DisplayList::drawIcon(int x, int y, IconImage image, IconDepth depth) {
+    IconPayload icon;
+    zeroFill(icon);
+    icon.x = (int16_t)x;
+    icon.y = (int16_t)y;
+    icon.image = image;
+    icon.depth = depth;
+    record(OP_ICON, boundsOf(x, y, x + WEATHER_ICON_SIZE - 1, y + WEATHER_ICON_SIZE - 1), &icon, sizeof(icon), 0);
+}
+
+void DisplayList::drawGlyphs(const void *font, const char *text, int x, int y, const DrawBounds &bounds) {
+    GlyphsPayload g;
+    zeroFill(g);
+    g.x = (int16_t)x;
+    g.y = (int16_t)y;
+    g.font = font;
+    size_t length = strlen(text) + 1;
+    uint8_t *tail = record(OP_GLYPHS, bounds, &g, sizeof(g), length);
+    if (tail) memcpy(tail, text, length);
+}
+
+void DisplayList::drawArc(int x, int y, int r, int fromDeg, int toDeg, uint32_t color) {
+    ArcPayload a;
+    zeroFill(a);
+    a.x = (int16_t)x;
+    a.y = (int16_t)y;
+    a.r = (int16_t)r;
+    a.fromDeg = (int16_t)fromDeg;
+    a.toDeg = (int16_t)toDeg;
+    a.color = color;
+    record(OP_ARC, boundsOf(x - r, y - r, x + r, y + r), &a, sizeof(a), 0);
+}
+
+static DrawBounds pointBounds(const int16_t points[][2], int count) {
+    int x0 = points[0][0], y0 = points[0][1], x1 = x0, y1 = y0;
+    for (int i = 1; i < count; i++) {
+        x0 = imin(x0, points[i][0]);
+        y0 = imin(y0, points[i][1]);
+        x1 = imax(x1, points[i][0]);
+        y1 = imax(y1, points[i][1]);
+    }
+    return boundsOf(x0, y0, x1, y1);
+}
+
+void DisplayList::fillPolygon(const int16_t points[][2], int count, uint32_t color) {
+    if (count < 3 || count > UINT8_MAX) return;
+    PointsPayload p;
+    zeroFill(p);
+    p.color = color;
+    p.count = (uint8_t)count;
+    p.spacing = 1;
+    uint8_t *tail = record(OP_FILL_POLYGON, pointBounds(points, count), &p, sizeof(p), count * 2 * sizeof(int16_t));
+    if (tail) memcpy(tail, points, count * 2 * sizeof(int16_t));
+}
+
+void DisplayList::drawPolyline(const int16_t points[][2], int count, int spacing, uint32_t color) {
+    if (count < 2 || count > UINT8_MAX) return;
+    PointsPayload p;
+    zeroFill(p);
+    p.color = color;
+    p.count = (uint8_t)count;
+    p.spacing = (uint8_t)(spacing < 1 ? 1 : spacing);
+    uint8_t *tail = record(OP_POLYLINE, pointBounds(points, count), &p, sizeof(p), count * 2 * sizeof(int16_t));
+    if (tail) memcpy(tail, points, count * 2 * sizeof(int16_t));
+}
+
+// ---- Diffing ----
+
+static bool touches(const DrawBounds &a, const DrawBounds &b) {
+    return a.x <= b.x + b.w && b.x <= a.x + a.w && a.y <= b.y + b.h && b.y <= a.y + a.h;
+}
+
+static DrawBounds unite(const DrawBounds &a, const DrawBounds &b) {
+    return boundsOf(imin(a.x, b.x), imin(a.y, b.y),
+                    imax(a.x + a.w, b.x + b.w) - 1, imax(a.y + a.h, b.y + b.h) - 1);
+}
+
+static void addRect(DrawBounds *rects, int &count, int maxRects, const DrawBounds &r) {
+    for (int i = 0; i < count; i++) {
+        if (touches(rects[i], r)) {
+            rects[i] = unite(rects[i], r);
+            return;
+        }
+    }
+    if (count < maxRects) {
+        rects[count++] = r;
+    } else {
+        rects[count - 1] = unite(rects[count - 1], r);
+    }
+}
+
+// End of the run of commands recorded under the same panel as cmd
+static const DrawCommand *panelRunEnd(const DisplayList &list, const DrawCommand *cmd, int &count) {
+    uint8_t panel = cmd->panel;
+    count = 0;
+    while (cmd && cmd->panel == panel) {
+        count++;
+        cmd = list.next(cmd);
+    }
+    return cmd;
+}
+
+int diffDisplayLists(const DisplayList &before, const DisplayList &after, DrawBounds *rects, int maxRects) {
+    if (before.overflowed() || after.overflowed() || maxRects < 1) return -1;
+
+    int count = 0;
+    const DrawCommand *a = before.first();
+    const DrawCommand *b = after.first();
+
+    while (a || b) {
+        uint8_t panel = a ? a->panel : b->panel;
+        int countA = 0, countB = 0;
+        const DrawCommand *endA = (a && a->panel == panel) ? panelRunEnd(before, a, countA) : a;
+        const DrawCommand *endB = (b && b->panel == panel) ? panelRunEnd(after, b, countB) : b;
+
+        if (countA == countB) {
+            // Same shape: only commands that differ are dirty
+            const DrawCommand *ca = a, *cb = b;
+            for (int i = 0; i < countA; i++) {
+                if (ca->size != cb->size || memcmp(ca, cb, ca->size) != 0) {
+                    addRect(rects, count, maxRects, ca->bounds);
+                    addRect(rects, count, maxRects, cb->bounds);
+                }
+                ca = before.next(ca);
+                cb = after.next(cb);
+            }
+        } else {
+            // Panel content changed shape: everything it drew before or now is dirty
+            for (const DrawCommand *c = a; c != endA; c = before.next(c)) addRect(rects, count, maxRects, c->bounds);
+            for (const DrawCommand *c = b; c != endB; c = after.next(c)) addRect(rects, count, maxRects, c->bounds);
+        }
+
+        a = endA;
+        b = endB;
+    }
+    return count;
+}
@@ -0,0 +1,140 @@
+#ifndef DISPLAYLIST_H
+#define DISPLAYLIST_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "icon_images.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+// Compact display list: panels record draw commands into a flat arena and a
+// backend rasterises them later (see canvas_backend.h). Plain C++ with no
+// display dependencies, so the same list can be diffed, persisted or walked
+// by headless tools on the host.
+
+enum DrawOp : uint8_t {
+    OP_TEXT,            // Built-in 6x8 font, scaled by text size
+    OP_LINE,
+    OP_RECT,
+    OP_FILL_RECT,
+    OP_CIRCLE,
+    OP_FILL_CIRCLE,
+    OP_FILL_TRIANGLE,
+    OP_PIXEL,
+    OP_ICON,            // 64x64 pre-dithered icon (icon_images.h)
+    OP_GLYPHS,          // Text from the pre-rasterised glyph atlas
+    OP_ARC,             // Circle arc between two angles in degrees
+    OP_FILL_POLYGON,    // Convex polygon, filled as a triangle fan
+    OP_POLYLINE         // Connected segments, optionally dotted
+};
+
+struct DrawBounds {
+    int16_t x, y, w, h;
+};
+
+// Every command starts with this header; the op-specific payload follows
+struct DrawCommand {
+    uint8_t op;
+    uint8_t panel;       // PanelId the command was recorded under
+    uint16_t size;       // Header + payload bytes
+    DrawBounds bounds;   // Pixels the command may touch
+};
+
+struct TextPayload { int16_t x, y; uint32_t color, background; uint8_t size, datum; };  // + NUL-terminated text
+struct LinePayload { int16_t x0, y0, x1, y1; uint32_t color; };
+struct RectPayload { int16_t x, y, w, h; uint32_t color; };
+struct CirclePayload { int16_t x, y, r; uint32_t color; };
+struct TrianglePayload { int16_t x0, y0, x1, y1, x2, y2; uint32_t color; };
+struct PixelPayload { int16_t x, y; uint32_t color; };
+struct IconPayload { int16_t x, y; IconImage image; IconDepth depth; };
+struct GlyphsPayload { int16_t x, y; const void *font; };                             // + NUL-terminated text
+struct ArcPayload { int16_t x, y, r, fromDeg, toDeg; uint32_t color; };
+struct PointsPayload { uint32_t color; uint8_t count, spacing; };                      // + count x/y int16 pairs
+
+class DisplayList {
+public:
+    DisplayList(uint8_t *arena, size_t capacity);
+
+    void clear();
+    size_t size() const { return used; }
+    size_t capacity() const { return cap; }
+    bool overflowed() const { return overflow; }
+    const uint8_t *data() const { return arena; }
+
+    // Replace the contents with previously saved bytes; false if they do not fit or parse
+    bool assign(const uint8_t *bytes, size_t length);
+
+    // Commands recorded from now on belong to this panel
+    void setPanel(uint8_t panel) { currentPanel = panel; }
+
+    // Text state, mirroring the LovyanGFX calls the panels use
+    void setTextSize(uint8_t size) { textSize = size; }
+    void setTextDatum(uint8_t datum) { textDatum = datum; }
+    void setTextColor(uint32_t color, uint32_t background) { textColor = color; textBackground = background; }
+    int textWidth(const char *text) const;
+    int fontHeight() const { return 8 * textSize; }
+
+    void drawString(const char *text, int x, int y);
+#ifdef ARDUINO
+    void drawString(const String &text, int x, int y) { drawString(text.c_str(), x, y); }
+    int textWidth(const String &text) const { return textWidth(text.c_str()); }
+#endif
+    void drawLine(int x0, int y0, int x1, int y1, uint32_t color);
+    void drawFastHLine(int x, int y, int w, uint32_t color) { drawLine(x, y, x + w - 1, y, color); }
+    void drawRect(int x, int y, int w, int h, uint32_t color);
+    void fillRect(int x, int y, int w, int h, uint32_t color);
+    void drawCircle(int x, int y, int r, uint32_t color);
+    void fillCircle(int x, int y, int r, uint32_t color);
+    void fillTriangle(int x0, int y0, int x1, int y1, int x2, int y2, uint32_t color);
+    void drawPixel(int x, int y, uint32_t color);
+    void drawIcon(int x, int y, IconImage image, IconDepth depth);
+    void drawGlyphs(const void *font, const char *text, int x, int y, const DrawBounds &bounds);
+    void drawArc(int x, int y, int r, int fromDeg, int toDeg, uint32_t color);
+    void fillPolygon(const int16_t points[][2], int count, uint32_t color);
+    void drawPolyline(const int16_t points[][2], int count, int spacing, uint32_t color);
+
+    // Iteration: first() then next() until nullptr. Payloads may be unaligned,
+    // so read them with payload().
+    const DrawCommand *first() const { return used ? (const DrawCommand *)arena : nullptr; }
+    const DrawCommand *next(const DrawCommand *cmd) const;
+
+    template <typename T>
+    static T payload(const DrawCommand *cmd);
+    static const char *payloadText(const DrawCommand *cmd, size_t fixedSize) {
+        return (const char *)cmd + sizeof(DrawCommand) + fixedSize;
+    }
+    static const int16_t *payloadPoints(const DrawCommand *cmd) {
+        return (const int16_t *)((const uint8_t *)cmd + sizeof(DrawCommand) + sizeof(PointsPayload));
+    }
+
+private:
+    uint8_t *record(DrawOp op, const DrawBounds &bounds, const void *fixed, size_t fixedSize, size_t extra);
+
+    uint8_t *arena;
+    size_t cap;
+    size_t used;
+    bool overflow;
+    uint8_t currentPanel;
+    uint8_t textSize;
+    uint8_t textDatum;
+    uint32_t textColor;
+    uint32_t textBackground;
+};
+
+template <typename T>
+T DisplayList::payload(const DrawCommand *cmd) {
+    T value;
+    const uint8_t *src = (const uint8_t *)cmd + sizeof(DrawCommand);
+    for (size_t i = 0; i < sizeof(T); i++) ((uint8_t *)&value)[i] = src[i];
+    return value;
+}
+
+// Changed screen areas between two recordings of the same layout. Commands are
+// compared panel by panel; any command that differs contributes its old and new
+// bounds. Returns the number of rectangles written (merged to fit maxRects), or
+// -1 if the lists cannot be compared and everything must be treated as changed.
+int diffDisplayLists(const DisplayList &before, const DisplayList &after, DrawBounds *rects, int maxRects);
+
+#endif // DISPLAYLIST_H
@@ -0,0 +1,58 @@
+#include "downsample.h"
+
+int lttbSelect(const int16_t *values, int count, int target, uint16_t *indices) {
+    if (count <= 0) return 0;
+    if (target >= count) {
+        for (int i = 0; i < count; i++) indices[i] = i;
+        return count;
+    }
+    if (target < 3) {
+        indices[0] = 0;
+        if (target < 2 || count < 2) return 1;
+        indices[1] = count - 1;
+        return 2;
+    }
+
+    // The samples between the end points split into target - 2 buckets;
+    // bucket b covers [start(b), start(b + 1))
+    const int buckets = target - 2;
+    auto bucketStart = [&](int b) { return 1 + b * (count - 2) / buckets; };
+
+    int picked = 0;
+    int a = 0;
+    indices[picked++] = 0;
+
+    for (int b = 0; b < buckets; b++) {
+        int start = bucketStart(b);
+        int end = bucketStart(b + 1);
+
+        // Next bucket's centroid, kept as sums over n to stay in integers
+        int nextStart = end;
+        int nextEnd = b + 1 < buckets ? bucketStart(b + 2) : count;
+        if (b + 1 == buckets) nextStart = count - 1;
+        int64_t n = nextEnd - nextStart;
+        int64_t sumX = 0, sumY = 0;
+        for (int i = nextStart; i < nextEnd; i++) {
+            sumX += i;
+            sumY += values[i];
+        }
+
+        // Twice the triangle area, times n: |(xa - xc)(yb - ya) - (xa - xb)(yc - ya)|
+        int64_t ax = a, ay = values[a];
+        int64_t best = -1;
+        int bestIndex = start;
+        for (int i = start; i < end; i++) {
+            int64_t area = (ax * n - sumX) * (values[i] - ay) - (ax - i) * (sumY - ay * n);
+            if (area < 0) area = -area;
+            if (area > best) {
+                best = area;
+                bestIndex = i;
+            }
+        }
+        indices[picked++] = bestIndex;
+        a = bestIndex;
+    }
+
+    indices[picked++] = count - 1;
+    return picked;
+}
@@ -0,0 +1,18 @@
+#ifndef DOWNSAMPLE_H
+#define DOWNSAMPLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Largest-Triangle-Three-Buckets downsampling (Steinarsson 2013) for graph
+// series. Picks `target` of `count` evenly spaced samples that keep the
+// visual shape: the first and last sample, plus from each bucket in between
+// the sample spanning the largest triangle with the previous pick and the
+// next bucket's average. Integer arithmetic only, no allocation.
+
+// Writes the picked sample indices, ascending, and returns how many there
+// are: min(count, target). With target >= count (or < 3) every sample, or the
+// end points, are picked.
+int lttbSelect(const int16_t *values, int count, int target, uint16_t *indices);
+
+#endif // DOWNSAMPLE_H
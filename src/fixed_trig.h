@@ -0,0 +1,93 @@
+#ifndef FIXED_TRIG_H
+#define FIXED_TRIG_H
+
+#include <stdint.h>
+
+// Fixed-point trigonometry for the widgets (compass, RSSI arcs, wind arrow).
+//
+// Angles are in tenths of a degree, results are Q14 (16384 == 1.0). The
+// quarter-wave table is generated at compile time and interpolated linearly,
+// which is exact to well under a pixel at the radii used on the dashboard.
+
+#define TRIG_Q14_ONE 16384
+#define TRIG_FULL_CIRCLE 3600
+#define TRIG_QUARTER 900
+
+namespace fixed_trig {
+
+// Taylor series, accurate to ~1e-10 on [0, pi/2]; only evaluated at compile time
+constexpr double taylorSin(double x) {
+    double term = x;
+    double sum = x;
+    for (int n = 1; n < 10; n++) {
+        term *= -x * x / ((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+struct SineTable {
+    int16_t value[91];  // sin(0..90 degrees) in Q14
+};
+
+constexpr SineTable makeSineTable() {
+    SineTable table = {};
+    for (int deg = 0; deg <= 90; deg++) {
+        table.value[deg] = (int16_t)(taylorSin(deg * 3.14159265358979323846 / 180.0) * TRIG_Q14_ONE + 0.5);
+    }
+    return table;
+}
+
+constexpr SineTable SINE_TABLE = makeSineTable();
+
+static_assert(SINE_TABLE.value[0] == 0, "sin(0) must be exact");
+static_assert(SINE_TABLE.value[30] == TRIG_Q14_ONE / 2, "sin(30) must be exact");
+static_assert(SINE_TABLE.value[90] == TRIG_Q14_ONE, "sin(90) must be exact");
+
+}  // namespace fixed_trig
+
+// sin() of an angle in tenths of a degree, Q14
+constexpr int32_t isin10(int32_t deci) {
+    int32_t a = deci % TRIG_FULL_CIRCLE;
+    if (a < 0) a += TRIG_FULL_CIRCLE;
+
+    int32_t quadrant = a / TRIG_QUARTER;
+    int32_t r = a % TRIG_QUARTER;
+    if (quadrant & 1) r = TRIG_QUARTER - r;
+
+    int32_t index = r / 10;
+    int32_t frac = r % 10;
+    int32_t value = fixed_trig::SINE_TABLE.value[index];
+    if (frac != 0) {
+        value += (fixed_trig::SINE_TABLE.value[index + 1] - value) * frac / 10;
+    }
+    return quadrant >= 2 ? -value : value;
+}
+
+// cos() of an angle in tenths of a degree, Q14
+constexpr int32_t icos10(int32_t deci) {
+    return isin10(deci + TRIG_QUARTER);
+}
+
+// Scale a Q14 value by an integer length with rounding
+constexpr int32_t mulQ14(int32_t length, int32_t q14) {
+    return (length * q14 + (q14 >= 0 ? TRIG_Q14_ONE / 2 : -TRIG_Q14_ONE / 2)) / TRIG_Q14_ONE;
+}
+
+// Point at distance r from the origin in direction deci (0 = +x, clockwise on screen)
+constexpr int32_t polarX(int32_t r, int32_t deci) { return mulQ14(r, icos10(deci)); }
+constexpr int32_t polarY(int32_t r, int32_t deci) { return mulQ14(r, isin10(deci)); }
+
+// Rotate (x, y) by deci around the origin
+constexpr int32_t rotateX(int32_t x, int32_t y, int32_t deci) {
+    return mulQ14(x, icos10(deci)) - mulQ14(y, isin10(deci));
+}
+constexpr int32_t rotateY(int32_t x, int32_t y, int32_t deci) {
+    return mulQ14(y, icos10(deci)) + mulQ14(x, isin10(deci));
+}
+
+static_assert(isin10(2700) == -TRIG_Q14_ONE, "quadrant folding");
+static_assert(icos10(1800) == -TRIG_Q14_ONE, "cos via phase shift");
+static_assert(polarX(75, 2250) == -53 && polarY(75, 2250) == -53, "compass diagonal");
+
+#endif // FIXED_TRIG_H
@@ -0,0 +1,91 @@
+#include "frame_codec.h"
+#include <string.h>
+
+size_t rleEncodeRow(const uint8_t *src, size_t rowBytes, uint8_t *dst, size_t dstCapacity) {
+    size_t in = 0;
+    size_t out = 0;
+    size_t literalStart = 0;
+    size_t literalCount = 0;
+
+    auto flushLiteral = [&]() -> bool {
+        while (literalCount > 0) {
+            size_t chunk = literalCount > RLE_MAX_LITERAL ? RLE_MAX_LITERAL : literalCount;
+            if (out + 1 + chunk > dstCapacity) return false;
+            dst[out++] = (uint8_t)(chunk - 1);
+            memcpy(dst + out, src + literalStart, chunk);
+            out += chunk;
+            literalStart += chunk;
+            literalCount -= chunk;
+        }
+        return true;
+    };
+
+    while (in < rowBytes) {
+        uint8_t value = src[in];
+        size_t run = 1;
+        while (in + run < rowBytes && run < RLE_MAX_RUN && src[in + run] == value) {
+            run++;
+        }
+
+        if (run >= RLE_MIN_RUN) {
+            if (!flushLiteral()) return 0;
+            if (out + 2 > dstCapacity) return 0;
+            dst[out++] = (uint8_t)(0x80 | (run - RLE_MIN_RUN));
+            dst[out++] = value;
+            in += run;
+            literalStart = in;
+        } else {
+            if (literalCount == 0) literalStart = in;
+            literalCount += run;
+            in += run;
+        }
+    }
+
+    if (!flushLiteral()) return 0;
+    return out;
+}
+
+size_t rleDecodeRow(const uint8_t *src, size_t srcLength, uint8_t *dst, size_t rowBytes) {
+    size_t in = 0;
+    size_t out = 0;
+
+    while (out < rowBytes) {
+        if (in >= srcLength) return 0;
+        uint8_t control = src[in++];
+
+        if (control & 0x80) {
+            size_t run = (control & 0x7F) + RLE_MIN_RUN;
+            if (in >= srcLength || out + run > rowBytes) return 0;
+            memset(dst + out, src[in++], run);
+            out += run;
+        } else {
+            size_t count = control + 1;
+            if (in + count > srcLength || out + count > rowBytes) return 0;
+            memcpy(dst + out, src + in, count);
+            in += count;
+            out += count;
+        }
+    }
+
+    return in;
+}
+
+size_t rleEncodeFrame(const uint8_t *frame, size_t rowBytes, int rows, uint8_t *dst, size_t dstCapacity) {
+    size_t out = 0;
+    for (int row = 0; row < rows; row++) {
+        size_t written = rleEncodeRow(frame + row * rowBytes, rowBytes, dst + out, dstCapacity - out);
+        if (written == 0) return 0;
+        out += written;
+    }
+    return out;
+}
+
+bool rleDecodeFrame(const uint8_t *src, size_t srcLength, uint8_t *frame, size_t rowBytes, int rows) {
+    size_t in = 0;
+    for (int row = 0; row < rows; row++) {
+        size_t consumed = rleDecodeRow(src + in, srcLength - in, frame + row * rowBytes, rowBytes);
+        if (consumed == 0) return false;
+        in += consumed;
+    }
+    return in == srcLength;
+}
@@ -0,0 +1,35 @@
+#ifndef FRAME_CODEC_H
+#define FRAME_CODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Row-based run-length codec for packed 4bpp frames.
+//
+// Each row is encoded independently so a frame can be decoded band by band.
+// Control byte c:
+//   c <  0x80: literal, the next (c + 1) bytes are copied as-is (1..128)
+//   c >= 0x80: run, the next byte is repeated (c & 0x7F) + 3 times (3..130)
+//
+// Plain C++ with no Arduino dependencies so it can be benchmarked on a host.
+
+#define RLE_MAX_LITERAL 128
+#define RLE_MIN_RUN 3
+#define RLE_MAX_RUN 130
+
+// Worst case encoded size of one row (all literals)
+inline size_t rleMaxRowSize(size_t rowBytes) {
+    return rowBytes + (rowBytes + RLE_MAX_LITERAL - 1) / RLE_MAX_LITERAL;
+}
+
+// Encode one row. Returns bytes written, or 0 if dst is too small.
+size_t rleEncodeRow(const uint8_t *src, size_t rowBytes, uint8_t *dst, size_t dstCapacity);
+
+// Decode one row of exactly rowBytes. Returns bytes consumed, or 0 on corrupt input.
+size_t rleDecodeRow(const uint8_t *src, size_t srcLength, uint8_t *dst, size_t rowBytes);
+
+// Encode/decode a whole frame of rows * rowBytes bytes
+size_t rleEncodeFrame(const uint8_t *frame, size_t rowBytes, int rows, uint8_t *dst, size_t dstCapacity);
+bool rleDecodeFrame(const uint8_t *src, size_t srcLength, uint8_t *frame, size_t rowBytes, int rows);
+
+#endif // FRAME_CODEC_H
@@ -0,0 +1,505 @@
+#include "framestore.h"
+#include "constants.h"
+#include "frame_codec.h"
+#include "displaylist.h"
+#include "utils.h"
+#include <M5Unified.h>
+#include <esp_partition.h>
+#include <esp_rom_crc.h>
+#include <esp_heap_caps.h>
+
+extern M5Canvas canvas;
+extern int refreshCounter;
+extern DisplayList displayList;
+extern DisplayList previousList;
+
+#define FRAME_SNAPSHOT_MAGIC 0x46524D31  // "FRM1"
+#define FRAME_SNAPSHOT_VERSION 4
+#define FRAME_ROW_BYTES (SCREEN_WIDTH / 2)
+#define FRAME_ENCODE_CAPACITY (FRAME_SLOT_SIZE - FRAME_PAYLOAD_OFFSET)
+
+struct FrameSnapshotHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t width;
+    uint16_t height;
+    uint16_t listSize;      // Content display list stored after the payload
+    uint32_t sequence;      // Increments with every save, newest valid slot wins
+    uint32_t payloadSize;
+    uint32_t payloadCrc;
+    uint32_t refreshCount;  // Partial refreshes since the last full-quality refresh
+    uint32_t listCrc;
+};
+
+// Payload starts on its own flash word so it can be written separately from the header
+#define FRAME_PAYLOAD_OFFSET 32
+static_assert(sizeof(FrameSnapshotHeader) <= FRAME_PAYLOAD_OFFSET, "snapshot header too large");
+
+static const esp_partition_t *framePartition = nullptr;
+static int newestSlot = -1;
+static uint32_t newestSequence = 0;
+static bool slotsScanned = false;
+
+// M5GFX has no call for telling the EPD driver what the glass already shows.
+// The snapshot is pushed into the panel buffer, then the area the driver
+// would refresh on the next display() (_range_mod, protected in
+// Panel_Device) is reset so that push is never driven. This relies on driver
+// internals, so it is only done on the M5GFX release it was checked against
+// (pinned in platformio.ini; M5GFX stamps its release into LGFX_VERSION_*)
+// and on the PaperS3's EPD panel. Anywhere else nothing is restored and the
+// next refresh is a full one. The ENABLE_BENCHMARKS build checks the effect.
+#if defined(LGFX_VERSION_MAJOR) && LGFX_VERSION_MAJOR == 0 && LGFX_VERSION_MINOR == 2 && LGFX_VERSION_PATCH == 9
+#define FRAME_RESTORE_SUPPORTED 1
+#else
+#define FRAME_RESTORE_SUPPORTED 0
+#endif
+
+struct PanelModifiedRange : public lgfx::Panel_Device {
+    // The inherited member, reached through a member pointer on the panel as
+    // the Panel_Device it really is instead of a cast to this class
+    static lgfx::range_rect_t &of(lgfx::Panel_Device *panel) {
+        lgfx::range_rect_t lgfx::Panel_Device::*range = &PanelModifiedRange::_range_mod;
+        return panel->*range;
+    }
+};
+
+static bool panelStateRestorable() {
+    return FRAME_RESTORE_SUPPORTED && M5.getBoard() == m5::board_t::board_M5PaperS3 &&
+           M5.Display.getPanel() != nullptr;
+}
+
+static void clearPanelModifiedRange() {
+    lgfx::range_rect_t &range = PanelModifiedRange::of(M5.Display.getPanel());
+    range.left = INT16_MAX;
+    range.top = INT16_MAX;
+    range.right = 0;
+    range.bottom = 0;
+}
+
+#ifdef ENABLE_BENCHMARKS
+bool panelPendingRefresh(int &x, int &y, int &w, int &h) {
+    if (!panelStateRestorable()) return false;
+    const lgfx::range_rect_t &range = PanelModifiedRange::of(M5.Display.getPanel());
+    if (range.left > range.right || range.top > range.bottom) return false;
+    x = range.left;
+    y = range.top;
+    w = range.right - range.left + 1;
+    h = range.bottom - range.top + 1;
+    return true;
+}
+#endif
+
+static int slotCount() {
+    return framePartition ? framePartition->size / FRAME_SLOT_SIZE : 0;
+}
+
+static bool openPartition() {
+    if (framePartition == nullptr) {
+        framePartition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                                  (esp_partition_subtype_t)FRAME_PARTITION_SUBTYPE,
+                                                  FRAME_PARTITION_LABEL);
+        if (framePartition == nullptr) {
+            Serial.println("Frame snapshot partition not found");
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool readHeader(int slot, FrameSnapshotHeader &header) {
+    if (esp_partition_read(framePartition, slot * FRAME_SLOT_SIZE, &header, sizeof(header)) != ESP_OK) {
+        return false;
+    }
+    return header.magic == FRAME_SNAPSHOT_MAGIC &&
+           header.version == FRAME_SNAPSHOT_VERSION &&
+           header.width == SCREEN_WIDTH &&
+           header.height == SCREEN_HEIGHT &&
+           header.payloadSize + header.listSize <= FRAME_SLOT_SIZE - FRAME_PAYLOAD_OFFSET;
+}
+
+// Find the slot holding the highest sequence number
+static void scanSlots() {
+    newestSlot = -1;
+    newestSequence = 0;
+    for (int slot = 0; slot < slotCount(); slot++) {
+        FrameSnapshotHeader header;
+        if (readHeader(slot, header) && (newestSlot < 0 || header.sequence > newestSequence)) {
+            newestSlot = slot;
+            newestSequence = header.sequence;
+        }
+    }
+    slotsScanned = true;
+}
+
+// Patches: panels a micro-wake pushed straight to the glass are appended to
+// the newest slot after its payload and list, so the snapshot keeps matching
+// the glass without rewriting the whole frame every minute. The log starts on
+// the first sector after the list and grows one record at a time; each sector
+// is erased when the first record reaches it, so no sector is erased more
+// than once per lap. Records carry the snapshot's sequence number, which
+// tells them apart from leftovers of an older snapshot in the same slot.
+#define FRAME_PATCH_MAGIC 0x50544348  // "PTCH"
+
+struct FramePatchHeader {
+    uint32_t magic;
+    uint32_t sequence;      // Snapshot the patch applies to
+    int16_t x, y, w, h;     // Screen rectangle; rows of (w + 1) / 2 bytes, x in the high nibble
+    uint32_t size;          // RLE bytes following the header
+    uint32_t crc;
+};
+
+static size_t patchLogStart(const FrameSnapshotHeader &header) {
+    return (FRAME_PAYLOAD_OFFSET + header.payloadSize + header.listSize + SPI_FLASH_SEC_SIZE - 1) &
+           ~(SPI_FLASH_SEC_SIZE - 1);
+}
+
+static size_t patchRecordSize(size_t encoded) {
+    return sizeof(FramePatchHeader) + ((encoded + 3) & ~3);
+}
+
+// Call fn(patch, data) for every valid patch of the slot's snapshot, oldest
+// first. Returns the offset just past the last one, where the next goes.
+template <typename F>
+static size_t walkPatches(int slot, const FrameSnapshotHeader &header, F &&fn) {
+    size_t base = slot * FRAME_SLOT_SIZE;
+    size_t offset = patchLogStart(header);
+    while (offset + sizeof(FramePatchHeader) <= FRAME_SLOT_SIZE) {
+        FramePatchHeader patch;
+        if (esp_partition_read(framePartition, base + offset, &patch, sizeof(patch)) != ESP_OK ||
+            patch.magic != FRAME_PATCH_MAGIC || patch.sequence != header.sequence ||
+            offset + patchRecordSize(patch.size) > FRAME_SLOT_SIZE) {
+            break;
+        }
+        uint8_t *data = (uint8_t *)heap_caps_malloc(patch.size, MALLOC_CAP_SPIRAM);
+        bool valid = data != nullptr &&
+                     esp_partition_read(framePartition, base + offset + sizeof(patch), data, patch.size) == ESP_OK &&
+                     esp_rom_crc32_le(0, data, patch.size) == patch.crc;
+        if (valid) fn(patch, data);
+        heap_caps_free(data);
+        if (!valid) break;
+        offset += patchRecordSize(patch.size);
+    }
+    return offset;
+}
+
+// Decode a patch's rows into a full frame, nibble by nibble since the
+// rectangle need not start or end on a byte
+static bool applyPatch(uint8_t *frame, const FramePatchHeader &patch, const uint8_t *data) {
+    if (patch.x < 0 || patch.y < 0 || patch.w <= 0 || patch.h <= 0 ||
+        patch.x + patch.w > SCREEN_WIDTH || patch.y + patch.h > SCREEN_HEIGHT) {
+        return false;
+    }
+    size_t rowBytes = (patch.w + 1) / 2;
+    uint8_t row[FRAME_ROW_BYTES];
+    size_t left = patch.size;
+    for (int r = 0; r < patch.h; r++) {
+        size_t used = rleDecodeRow(data, left, row, rowBytes);
+        if (used == 0) return false;
+        data += used;
+        left -= used;
+
+        uint8_t *dst = frame + (patch.y + r) * FRAME_ROW_BYTES;
+        for (int i = 0; i < patch.w; i++) {
+            uint8_t level = (i & 1) ? row[i >> 1] & 0x0F : row[i >> 1] >> 4;
+            int x = patch.x + i;
+            uint8_t &pair = dst[x >> 1];
+            pair = (x & 1) ? (pair & 0xF0) | level : (pair & 0x0F) | (level << 4);
+        }
+    }
+    return true;
+}
+
+// Decode the newest snapshot with its patches into frame (SCREEN_HEIGHT rows
+// of FRAME_ROW_BYTES). The content list goes into list if it is not null.
+static bool decodeNewest(uint8_t *frame, DisplayList *list, FrameSnapshotHeader &header) {
+    if (newestSlot < 0 || !readHeader(newestSlot, header)) return false;
+
+    uint8_t *payload = (uint8_t *)heap_caps_malloc(header.payloadSize + header.listSize, MALLOC_CAP_SPIRAM);
+    if (payload == nullptr) return false;
+
+    bool ok = esp_partition_read(framePartition, newestSlot * FRAME_SLOT_SIZE + FRAME_PAYLOAD_OFFSET,
+                                 payload, header.payloadSize + header.listSize) == ESP_OK &&
+              esp_rom_crc32_le(0, payload, header.payloadSize) == header.payloadCrc &&
+              rleDecodeFrame(payload, header.payloadSize, frame, FRAME_ROW_BYTES, SCREEN_HEIGHT);
+
+    // The display list that drew this frame lets the next render push only what changed
+    const uint8_t *stored = payload + header.payloadSize;
+    if (list != nullptr && (!ok || esp_rom_crc32_le(0, stored, header.listSize) != header.listCrc ||
+                            !list->assign(stored, header.listSize))) {
+        list->clear();
+    }
+    heap_caps_free(payload);
+
+    if (ok) {
+        walkPatches(newestSlot, header, [&](const FramePatchHeader &patch, const uint8_t *data) {
+            ok &= applyPatch(frame, patch, data);
+        });
+    }
+    return ok;
+}
+
+bool restoreFrameSnapshot() {
+    if (!panelStateRestorable()) {
+        Serial.println("Frame restore not supported by this M5GFX or panel");
+        return false;
+    }
+    if (!openPartition()) return false;
+    scanSlots();
+    if (newestSlot < 0) {
+        Serial.println("No frame snapshot stored");
+        return false;
+    }
+
+    unsigned long start = micros();
+    FrameSnapshotHeader header;
+    bool ok = false;
+    if (canvas.createSprite(SCREEN_WIDTH, SCREEN_HEIGHT)) {
+        ok = decodeNewest((uint8_t *)canvas.getBuffer(), &previousList, header);
+        if (ok) {
+            M5.Display.startWrite();
+            canvas.pushSprite(0, 0);
+            clearPanelModifiedRange();
+            M5.Display.endWrite();
+        }
+        canvas.deleteSprite();
+    }
+
+    if (!ok) {
+        previousList.clear();
+        Serial.println("Frame snapshot corrupt, ignoring");
+        return false;
+    }
+
+    refreshCounter = header.refreshCount;
+    Serial.printf("Frame snapshot restored from slot %d (%u bytes, %lu us)\n",
+                  newestSlot, (unsigned)header.payloadSize, micros() - start);
+    return true;
+}
+
+// Write a snapshot into the slot after the newest and make it the newest
+static bool writeSlot(const uint8_t *payload, size_t payloadSize, const uint8_t *list, size_t listSize,
+                      uint32_t refreshCount) {
+    // Rotate through the slots so each flash sector is erased only once per lap
+    int slot = (newestSlot + 1) % slotCount();
+    FrameSnapshotHeader header = {};
+    header.magic = FRAME_SNAPSHOT_MAGIC;
+    header.version = FRAME_SNAPSHOT_VERSION;
+    header.width = SCREEN_WIDTH;
+    header.height = SCREEN_HEIGHT;
+    header.sequence = newestSequence + 1;
+    header.payloadSize = payloadSize;
+    header.payloadCrc = esp_rom_crc32_le(0, payload, payloadSize);
+    header.refreshCount = refreshCount;
+    header.listSize = listSize;
+    header.listCrc = esp_rom_crc32_le(0, list, listSize);
+
+    // Erase only the sectors in use (patches erase theirs as the log grows);
+    // the header goes in last so a torn write is never valid
+    size_t base = slot * FRAME_SLOT_SIZE;
+    bool ok = esp_partition_erase_range(framePartition, base, patchLogStart(header)) == ESP_OK &&
+              esp_partition_write(framePartition, base + FRAME_PAYLOAD_OFFSET, payload, payloadSize) == ESP_OK &&
+              (listSize == 0 || esp_partition_write(framePartition, base + FRAME_PAYLOAD_OFFSET + payloadSize,
+                                                    list, listSize) == ESP_OK) &&
+              esp_partition_write(framePartition, base, &header, sizeof(header)) == ESP_OK;
+    if (ok) {
+        newestSlot = slot;
+        newestSequence = header.sequence;
+    }
+    return ok;
+}
+
+// Snapshot being assembled, possibly one band of rows at a time
+static uint8_t *encodeBuffer = nullptr;
+static uint8_t *pendingPayload = nullptr;
+static size_t pendingCapacity = 0;
+static size_t pendingSize = 0;
+static size_t pendingListSize = 0;
+static int pendingRows = 0;
+static bool pendingFailed = false;
+static unsigned long pendingEncodeTime = 0;
+
+bool reserveFrameSnapshot() {
+    if (encodeBuffer == nullptr) {
+        encodeBuffer = (uint8_t *)heap_caps_malloc(FRAME_ENCODE_CAPACITY, MALLOC_CAP_SPIRAM);
+    }
+    return encodeBuffer != nullptr;
+}
+
+static void releaseEncodeBuffer() {
+    heap_caps_free(encodeBuffer);
+    encodeBuffer = nullptr;
+}
+
+bool beginFrameSnapshot() {
+    if (!openPartition()) return false;
+    if (!slotsScanned) scanSlots();
+
+    if (!reserveFrameSnapshot()) {
+        // The glass is about to change, so the stored frame would be wrong
+        invalidateFrameSnapshot();
+        return false;
+    }
+
+    // The content list goes after the payload; drop it rather than the frame if it does not fit
+    pendingListSize = displayList.overflowed() ? 0 : displayList.size();
+    pendingCapacity = FRAME_ENCODE_CAPACITY - pendingListSize;
+    pendingPayload = encodeBuffer;
+    pendingSize = 0;
+    pendingRows = 0;
+    pendingFailed = false;
+    pendingEncodeTime = 0;
+    return true;
+}
+
+void appendFrameSnapshotRows(const uint8_t *rows, int count) {
+    if (pendingPayload == nullptr || pendingFailed) return;
+
+    unsigned long start = micros();
+    size_t encoded = rleEncodeFrame(rows, FRAME_ROW_BYTES, count, pendingPayload + pendingSize,
+                                    pendingCapacity - pendingSize);
+    pendingEncodeTime += micros() - start;
+
+    if (encoded == 0) {
+        pendingFailed = true;
+    } else {
+        pendingSize += encoded;
+        pendingRows += count;
+    }
+}
+
+void finishFrameSnapshot() {
+    if (pendingPayload == nullptr) return;
+    uint8_t *payload = pendingPayload;
+    size_t payloadSize = pendingSize;
+    size_t listSize = pendingListSize;
+    pendingPayload = nullptr;
+
+    if (pendingFailed || pendingRows != SCREEN_HEIGHT) {
+        Serial.println("Frame does not compress into a snapshot slot, dropping snapshot");
+        releaseEncodeBuffer();
+        invalidateFrameSnapshot();
+        return;
+    }
+
+    unsigned long start = micros();
+    bool ok = writeSlot(payload, payloadSize, displayList.data(), listSize, refreshCounter);
+    releaseEncodeBuffer();
+
+    if (ok) {
+        unsigned ratioTenths = FRAME_ROW_BYTES * SCREEN_HEIGHT * 10 / payloadSize;
+        logPrintf("Frame snapshot saved to slot %d: %u -> %u bytes (%u.%u:1), encode %lu us, write %lu us\n",
+                  newestSlot, FRAME_ROW_BYTES * SCREEN_HEIGHT, (unsigned)payloadSize,
+                  ratioTenths / 10, ratioTenths % 10, pendingEncodeTime, micros() - start);
+    } else {
+        Serial.println("Frame snapshot write failed");
+    }
+}
+
+void saveFrameSnapshot() {
+    if (canvas.getBuffer() == nullptr || !beginFrameSnapshot()) return;
+    appendFrameSnapshotRows((const uint8_t *)canvas.getBuffer(), SCREEN_HEIGHT);
+    finishFrameSnapshot();
+}
+
+void invalidateFrameSnapshot() {
+    if (!openPartition()) return;
+    if (!slotsScanned) scanSlots();
+    if (newestSlot < 0) return;
+
+    // Older slots would be picked up instead, so wipe every valid header
+    for (int slot = 0; slot < slotCount(); slot++) {
+        FrameSnapshotHeader header;
+        if (readHeader(slot, header)) {
+            esp_partition_erase_range(framePartition, slot * FRAME_SLOT_SIZE, SPI_FLASH_SEC_SIZE);
+        }
+    }
+    newestSlot = -1;
+    Serial.println("Frame snapshot invalidated");
+}
+
+// Append one patch record at offset in the newest slot
+static bool appendPatch(size_t offset, const FramePatchHeader &patch, const uint8_t *data) {
+    size_t base = newestSlot * FRAME_SLOT_SIZE;
+    size_t end = offset + patchRecordSize(patch.size);
+
+    // The rest of the sector the log is in was erased with it, unless an
+    // earlier append was torn; sectors beyond it are erased now
+    size_t fresh = (offset + SPI_FLASH_SEC_SIZE - 1) & ~(SPI_FLASH_SEC_SIZE - 1);
+    uint32_t words[64];
+    for (size_t at = offset; at < fresh && at < end; at += sizeof(words)) {
+        size_t length = min(sizeof(words), min(fresh, end) - at);
+        if (esp_partition_read(framePartition, base + at, words, length) != ESP_OK) return false;
+        for (size_t i = 0; i < length / sizeof(uint32_t); i++) {
+            if (words[i] != 0xFFFFFFFF) return false;
+        }
+    }
+    if (end > fresh) {
+        size_t erase = ((end + SPI_FLASH_SEC_SIZE - 1) & ~(SPI_FLASH_SEC_SIZE - 1)) - fresh;
+        if (esp_partition_erase_range(framePartition, base + fresh, erase) != ESP_OK) return false;
+    }
+
+    // Header last, as for the snapshot itself
+    return esp_partition_write(framePartition, base + offset + sizeof(patch), data, patch.size) == ESP_OK &&
+           esp_partition_write(framePartition, base + offset, &patch, sizeof(patch)) == ESP_OK;
+}
+
+// The log is full: fold the snapshot, its patches and this one into the next slot
+static bool rewriteWithPatch(const FramePatchHeader &patch, const uint8_t *data) {
+    uint8_t *frame = (uint8_t *)heap_caps_malloc(FRAME_ROW_BYTES * SCREEN_HEIGHT, MALLOC_CAP_SPIRAM);
+    FrameSnapshotHeader header;
+    bool ok = frame != nullptr && reserveFrameSnapshot() &&
+              decodeNewest(frame, &previousList, header) && applyPatch(frame, patch, data);
+    size_t payloadSize = ok ? rleEncodeFrame(frame, FRAME_ROW_BYTES, SCREEN_HEIGHT, encodeBuffer,
+                                             FRAME_ENCODE_CAPACITY - previousList.size())
+                            : 0;
+    ok = payloadSize > 0 &&
+         writeSlot(encodeBuffer, payloadSize, previousList.data(), previousList.size(), header.refreshCount);
+    heap_caps_free(frame);
+    releaseEncodeBuffer();
+    return ok;
+}
+
+void patchFrameSnapshot(const uint8_t *pixels, int x, int y, int w, int h) {
+    if (!openPartition()) return;
+    if (!slotsScanned) scanSlots();
+    if (newestSlot < 0) return;
+
+    unsigned long start = micros();
+    size_t rowBytes = (w + 1) / 2;
+    size_t capacity = h * rleMaxRowSize(rowBytes);
+    uint8_t *encoded = (uint8_t *)heap_caps_malloc(capacity, MALLOC_CAP_SPIRAM);
+    size_t size = encoded != nullptr ? rleEncodeFrame(pixels, rowBytes, h, encoded, capacity) : 0;
+
+    FramePatchHeader patch = {};
+    patch.magic = FRAME_PATCH_MAGIC;
+    patch.sequence = newestSequence;
+    patch.x = x;
+    patch.y = y;
+    patch.w = w;
+    patch.h = h;
+    patch.size = size;
+    patch.crc = esp_rom_crc32_le(0, encoded, size);
+
+    FrameSnapshotHeader header;
+    bool ok = size > 0 && readHeader(newestSlot, header);
+    bool folded = false;
+    if (ok) {
+        size_t offset = walkPatches(newestSlot, header, [](const FramePatchHeader &, const uint8_t *) {});
+        if (offset + patchRecordSize(size) <= FRAME_SLOT_SIZE) {
+            ok = appendPatch(offset, patch, encoded);
+        } else {
+            ok = rewriteWithPatch(patch, encoded);
+            folded = true;
+        }
+    }
+    heap_caps_free(encoded);
+
+    if (!ok) {
+        // The glass no longer matches the stored frame
+        Serial.println("Frame snapshot patch failed");
+        invalidateFrameSnapshot();
+        return;
+    }
+    logPrintf("Frame snapshot %s: %dx%d at %d,%d, %u bytes, %lu us\n", folded ? "rewritten with patch" : "patched",
+              w, h, x, y, (unsigned)size, micros() - start);
+}
@@ -0,0 +1,40 @@
+#ifndef FRAMESTORE_H
+#define FRAMESTORE_H
+
+#include <Arduino.h>
+
+// Persist the last pushed 4bpp frame in the "frame" flash partition so the EPD
+// driver can be told what is on the glass after M5.Power.powerOff().
+
+// Decode the newest snapshot into the panel buffer without refreshing the glass.
+// Returns false if there is no valid snapshot (caller must assume a full refresh).
+bool restoreFrameSnapshot();
+
+// RLE-compress the current full-screen canvas into the next slot
+void saveFrameSnapshot();
+
+// Allocate the encode buffer ahead of the render (it is freed once the
+// snapshot is written). Done by beginFrameSnapshot() otherwise.
+bool reserveFrameSnapshot();
+
+// Same, for frames rendered in bands: begin, append every row top to bottom,
+// then finish (which writes the slot). Rows are packed 4bpp, SCREEN_WIDTH wide.
+bool beginFrameSnapshot();
+void appendFrameSnapshotRows(const uint8_t *rows, int count);
+void finishFrameSnapshot();
+
+// After pushing a panel straight to the glass (micro-wakes): record its pixels,
+// a w x h 4bpp sprite placed at (x, y), with the snapshot so the next restore
+// matches the glass. Drops the snapshot if that fails.
+void patchFrameSnapshot(const uint8_t *pixels, int x, int y, int w, int h);
+
+// Drop the snapshot after drawing something outside the canvas path
+void invalidateFrameSnapshot();
+
+#ifdef ENABLE_BENCHMARKS
+// Panel area the EPD driver would refresh on the next display(), in panel
+// coordinates; false if none or if frames cannot be restored on this build
+bool panelPendingRefresh(int &x, int &y, int &w, int &h);
+#endif
+
+#endif // FRAMESTORE_H
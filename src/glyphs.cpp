@@ -0,0 +1,94 @@
+#include "glyphs.h"
+#include "glyph_atlas.h"
+#include "displaylist.h"
+
+extern DisplayList displayList;
+
+static const GlyphMetrics *findGlyph(const GlyphFont &font, uint8_t code) {
+    for (int i = 0; i < font.count; i++) {
+        if (font.metrics[i].code == code) return &font.metrics[i];
+    }
+    return nullptr;
+}
+
+int glyphTextWidth(const GlyphFont &font, const char *text) {
+    int width = 0;
+    for (const char *c = text; *c; c++) {
+        const GlyphMetrics *glyph = findGlyph(font, (uint8_t)*c);
+        if (glyph) width += glyph->advance;
+    }
+    return width;
+}
+
+// Darken the 4bpp canvas in place: palette index 0 is black, 15 white, so
+// ink coverage a maps to index 15 - a and overlapping ink keeps the darker one
+static void blitGlyph(M5Canvas &target, const GlyphFont &font, const GlyphMetrics &glyph, int x, int y) {
+    const uint8_t *src = font.bitmaps + glyph.offset;
+    int srcStride = (glyph.width + 1) / 2;
+    int canvasW = target.width();
+    int canvasH = target.height();
+    uint8_t *buffer = (uint8_t *)target.getBuffer();
+    bool direct = buffer && target.getColorDepth() == 4;
+    int dstStride = (canvasW + 1) / 2;
+
+    for (int row = 0; row < glyph.height; row++) {
+        int py = y + row;
+        if (py < 0 || py >= canvasH) continue;
+        const uint8_t *srcRow = src + row * srcStride;
+
+        for (int col = 0; col < glyph.width; col++) {
+            int px = x + col;
+            if (px < 0 || px >= canvasW) continue;
+            uint8_t ink = (col & 1) ? (srcRow[col >> 1] & 0x0F) : (srcRow[col >> 1] >> 4);
+            if (ink == 0) continue;
+            uint8_t shade = 15 - ink;
+
+            if (direct) {
+                uint8_t &dst = buffer[py * dstStride + (px >> 1)];
+                uint8_t shift = (px & 1) ? 0 : 4;
+                if (((dst >> shift) & 0x0F) > shade) {
+                    dst = (dst & ~(0x0F << shift)) | (shade << shift);
+                }
+            } else {
+                target.drawPixel(px, py, shade * 0x1111);
+            }
+        }
+    }
+}
+
+void blitGlyphText(M5Canvas &target, const GlyphFont &font, const char *text, int x, int y) {
+    for (const char *c = text; *c; c++) {
+        const GlyphMetrics *glyph = findGlyph(font, (uint8_t)*c);
+        if (!glyph) continue;
+        blitGlyph(target, font, *glyph, x + glyph->xOffset, y + glyph->yOffset);
+        x += glyph->advance;
+    }
+}
+
+int drawGlyphText(const GlyphFont &font, const char *text, int x, int y, textdatum_t datum) {
+    int width = glyphTextWidth(font, text);
+    // Low two bits of a datum are the horizontal anchor: 0 left, 1 centre, 2 right
+    switch (datum & 3) {
+        case 1: x -= width / 2; break;
+        case 2: x -= width; break;
+        default: break;
+    }
+
+    // Record the ink box so the command can be culled and diffed
+    int left = INT16_MAX, top = INT16_MAX, right = INT16_MIN, bottom = INT16_MIN;
+    int pen = x;
+    for (const char *c = text; *c; c++) {
+        const GlyphMetrics *glyph = findGlyph(font, (uint8_t)*c);
+        if (!glyph) continue;
+        left = min(left, pen + glyph->xOffset);
+        right = max(right, pen + glyph->xOffset + glyph->width);
+        top = min(top, y + glyph->yOffset);
+        bottom = max(bottom, y + glyph->yOffset + glyph->height);
+        pen += glyph->advance;
+    }
+    if (left < right && top < bottom) {
+        DrawBounds bounds = { (int16_t)left, (int16_t)top, (int16_t)(right - left), (int16_t)(bottom - top) };
+        displayList.drawGlyphs(&font, text, x, y, bounds);
+    }
+    return width;
+}
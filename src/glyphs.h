@@ -0,0 +1,39 @@
+#ifndef GLYPHS_H
+#define GLYPHS_H
+
+#include <M5Unified.h>
+
+// Pre-rasterised 4bpp glyphs for the temperature readouts (see glyph_atlas.h,
+// generated by tools/gen_glyph_atlas.py). The degree sign is "\xB0".
+
+struct GlyphMetrics {
+    uint8_t code;        // Character (0xB0 = degree)
+    uint16_t offset;     // Start of the packed bitmap
+    uint8_t width, height;
+    int8_t xOffset;      // From the pen position
+    int8_t yOffset;      // From the top of the digits
+    uint8_t advance;
+};
+
+struct GlyphFont {
+    uint8_t height;      // Digit height in pixels
+    uint8_t count;
+    const GlyphMetrics *metrics;
+    const uint8_t *bitmaps;
+};
+
+extern const GlyphFont GLYPH_FONT_XL;  // Main temperature
+extern const GlyphFont GLYPH_FONT_L;   // Feels like
+extern const GlyphFont GLYPH_FONT_M;   // Today low/high
+extern const GlyphFont GLYPH_FONT_S;   // Hourly cells
+
+int glyphTextWidth(const GlyphFont &font, const char *text);
+
+// Record text into the display list; y is the top of the digits, datum picks
+// the horizontal anchor (left/centre/right). Returns the rendered width.
+int drawGlyphText(const GlyphFont &font, const char *text, int x, int y, textdatum_t datum = TL_DATUM);
+
+// Darken the glyphs into a canvas, pen starting at x (left-anchored)
+void blitGlyphText(M5Canvas &target, const GlyphFont &font, const char *text, int x, int y);
+
+#endif // GLYPHS_H
@@ -0,0 +1,201 @@
+#include "graph.h"
+#include "constants.h"
+#include "displaylist.h"
+#include "downsample.h"
+#include "series_kernels.h"
+#include <M5Unified.h>
+
+extern DisplayList displayList;
+
+// Plot rectangle plus the precomputed Q16 scales for one panel
+struct PlotScale {
+    int x, y, dx, dy;
+    int32_t lo, hi;       // Axis range in series units
+    int32_t xStepQ16;     // Pixels per sample
+    int32_t yShift;       // Series units are shifted left by this before scaling
+    int32_t yScaleQ15;    // Pixels per shifted series unit, below 1
+};
+
+static void plotArea(const GraphPanel &panel, int originX, int originY, PlotScale &s) {
+    s.x = originX + panel.x + 10 + GRAPH_LABEL_GUTTER;
+    s.y = originY + panel.y + GRAPH_AREA_Y_OFFSET;
+    s.dx = panel.dx - GRAPH_LABEL_GUTTER - GRAPH_SIDE_MARGIN;
+    s.dy = panel.dy - GRAPH_AREA_Y_OFFSET - GRAPH_BOTTOM_MARGIN;
+    s.xStepQ16 = panel.points > 1 ? ((int32_t)(s.dx - 1) << 16) / (panel.points - 1) : 0;
+}
+
+// The y mapping is one int16 multiply by a Q15 fraction (seriesToPixels):
+// the range is shifted up until it spans more than dy, so the scale stays
+// below 1, while the shifted distances still fit int16
+static void setRange(PlotScale &s, int32_t lo, int32_t hi) {
+    s.lo = lo;
+    s.hi = hi > lo ? (hi - lo <= INT16_MAX ? hi : lo + INT16_MAX) : lo + 1;
+    int32_t range = s.hi - s.lo;
+    s.yShift = 0;
+    while ((range << s.yShift) <= s.dy && (range << (s.yShift + 1)) <= INT16_MAX) s.yShift++;
+    s.yScaleQ15 = ((int32_t)s.dy << 15) / (range << s.yShift);
+}
+
+static inline int plotX(const PlotScale &s, int i) {
+    return s.x + ((i * s.xStepQ16) >> 16);
+}
+
+static inline int plotY(const PlotScale &s, int32_t v) {
+    if (v < s.lo) v = s.lo;
+    if (v > s.hi) v = s.hi;
+    return s.y + ((((s.hi - v) << s.yShift) * s.yScaleQ15) >> 15);
+}
+
+static int32_t floorDiv(int32_t a, int32_t b) {
+    return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+// Fit the axis to every series of the panel, widened to whole displayed units
+static void autoRange(const GraphPanel &panel, const GraphSeries *series, int seriesCount, PlotScale &s) {
+    int32_t lo = INT16_MAX, hi = INT16_MIN;
+    for (int n = 0; n < seriesCount && panel.points > 0; n++) {
+        int16_t seriesLo, seriesHi;
+        seriesMinMax(series[n].values, panel.points, seriesLo, seriesHi);
+        if (seriesLo < lo) lo = seriesLo;
+        if (seriesHi > hi) hi = seriesHi;
+    }
+    if (lo > hi) {
+        setRange(s, panel.yMin, panel.yMax);
+        return;
+    }
+
+    int32_t unit = panel.unitScale;
+    lo = floorDiv(lo, unit) * unit;
+    hi = -floorDiv(-hi, unit) * unit;
+    if (hi - lo < 2 * unit) {
+        lo -= unit;
+        hi = lo + 2 * unit;
+    }
+    setRange(s, lo, hi);
+}
+
+static void drawYLabels(const GraphPanel &panel, const PlotScale &s) {
+    int labelX = s.x - GRAPH_LABEL_GUTTER - 5;
+    char label[8];
+    displayList.setTextSize(1);
+    displayList.setTextDatum(TL_DATUM);
+    snprintf(label, sizeof(label), "%ld", (long)(s.hi / panel.unitScale));
+    displayList.drawString(label, labelX, s.y - 5);
+    snprintf(label, sizeof(label), "%ld", (long)(s.lo / panel.unitScale));
+    displayList.drawString(label, labelX, s.y + s.dy - 3);
+
+    // Dashed zero line when the range crosses zero
+    if (s.lo < 0 && s.hi > 0) {
+        int yPos = plotY(s, 0);
+        displayList.drawString("0", s.x - 20, yPos);
+        for (int xDash = s.x; xDash < s.x + s.dx - GRAPH_DASH_SPACING; xDash += GRAPH_DASH_SPACING) {
+            displayList.drawFastHLine(xDash, yPos, GRAPH_DASH_LENGTH, TFT_BLACK);
+        }
+    }
+}
+
+static void drawSeries(const GraphPanel &panel, const PlotScale &s, const GraphSeries &series) {
+    // Screen y of every sample in one pass (same mapping as plotY)
+    int16_t ys[UINT8_MAX];
+    seriesToPixels(series.values, panel.points, s.lo, s.hi, s.yShift, s.yScaleQ15, s.y, ys);
+
+    if (series.style == GRAPH_BARS) {
+        int32_t base = s.lo > 0 ? s.lo : (s.hi < 0 ? s.hi : 0);
+        int baseY = plotY(s, base);
+        int half = max(1, (int)(s.xStepQ16 >> 18));
+        for (int i = 0; i < panel.points; i++) {
+            int xPos = plotX(s, i);
+            int yPos = ys[i];
+            int left = max(s.x + 1, xPos - half);
+            int right = min(s.x + s.dx - 2, xPos + half);
+            int top = min(yPos, baseY);
+            int height = abs(baseY - yPos);
+            if (height > 0 && right >= left) {
+                displayList.fillRect(left, top, right - left + 1, height, GRAPH_BAR_COLOR);
+            }
+        }
+        return;
+    }
+
+    // The line keeps every sample unless there are more than pixel columns,
+    // then LTTB keeps the peaks and troughs
+    uint16_t picks[UINT8_MAX];
+    int16_t points[UINT8_MAX][2];
+    if (series.style != GRAPH_POINTS) {
+        int count = lttbSelect(series.values, panel.points, s.dx, picks);
+        for (int k = 0; k < count; k++) {
+            points[k][0] = plotX(s, picks[k]);
+            points[k][1] = ys[picks[k]];
+        }
+        int spacing = series.style == GRAPH_DOTTED ? GRAPH_DOT_SPACING : 1;
+        displayList.drawPolyline(points, count, spacing, TFT_BLACK);
+    }
+
+    // Markers are thinned on their own to what fits GRAPH_POINT_PITCH apart
+    int radius = series.style == GRAPH_DOTTED ? 1 : GRAPH_POINT_RADIUS;
+    int markers = lttbSelect(series.values, panel.points, s.dx / GRAPH_POINT_PITCH + 1, picks);
+    for (int k = 0; k < markers; k++) {
+        displayList.fillCircle(plotX(s, picks[k]), ys[picks[k]], radius, TFT_BLACK);
+    }
+}
+
+// Samples between x labels: the smallest whole-hour step that keeps them GRAPH_LABEL_PITCH apart
+static int labelStep(const PlotScale &s) {
+    static const uint8_t STEPS[] = { 1, 2, 3, 4, 6, 12, 24 };
+    for (uint8_t step : STEPS) {
+        if (((step * s.xStepQ16) >> 16) >= GRAPH_LABEL_PITCH) return step;
+    }
+    return STEPS[sizeof(STEPS) - 1];
+}
+
+void drawGraphFrames(const GraphPanel panels[], int count, int originX, int originY) {
+    char label[4];
+    for (int p = 0; p < count; p++) {
+        const GraphPanel &panel = panels[p];
+        PlotScale s;
+        plotArea(panel, originX, originY, s);
+
+        // Title
+        displayList.setTextSize(2);
+        displayList.setTextDatum(TC_DATUM);
+        displayList.drawString(panel.title, originX + panel.x + panel.dx / 2, originY + panel.y + GRAPH_TITLE_Y_OFFSET);
+        displayList.setTextDatum(TL_DATUM);
+
+        // X-axis labels
+        displayList.setTextSize(1);
+        for (int i = 0; i < panel.points; i += labelStep(s)) {
+            snprintf(label, sizeof(label), "%d", i);
+            displayList.drawString(label, plotX(s, i), s.y + s.dy + 5);
+        }
+
+        displayList.drawRect(s.x, s.y, s.dx, s.dy, TFT_BLACK);
+
+        if (!panel.autoRange) {
+            setRange(s, panel.yMin, panel.yMax);
+            drawYLabels(panel, s);
+        }
+    }
+}
+
+void drawGraphs(const GraphPanel panels[], int count, int originX, int originY,
+                const GraphSeries series[], const uint8_t seriesCount[]) {
+    int first = 0;
+    for (int p = 0; p < count; p++) {
+        const GraphPanel &panel = panels[p];
+        const GraphSeries *panelSeries = &series[first];
+        first += seriesCount[p];
+
+        PlotScale s;
+        plotArea(panel, originX, originY, s);
+        if (panel.autoRange) {
+            autoRange(panel, panelSeries, seriesCount[p], s);
+            drawYLabels(panel, s);
+        } else {
+            setRange(s, panel.yMin, panel.yMax);
+        }
+
+        for (int n = 0; n < seriesCount[p]; n++) {
+            drawSeries(panel, s, panelSeries[n]);
+        }
+    }
+}
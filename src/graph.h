@@ -0,0 +1,41 @@
+#ifndef GRAPH_H
+#define GRAPH_H
+
+#include <Arduino.h>
+
+// Integer-only graph engine. Series hold int16 fixed-point values
+// (panel.unitScale units per displayed unit, e.g. 10 for tenths).
+
+enum GraphStyle : uint8_t {
+    GRAPH_SOLID,    // Line with point markers
+    GRAPH_DOTTED,   // Dotted line with small markers
+    GRAPH_POINTS,   // Markers only
+    GRAPH_BARS      // Filled bars from the baseline (0 or yMin)
+};
+
+struct GraphSeries {
+    const int16_t *values;
+    GraphStyle style;
+};
+
+// Static description of one graph panel; the frame is drawn into the chrome layer
+struct GraphPanel {
+    int16_t x, y, dx, dy;
+    const char *title;
+    uint8_t points;      // Samples per series (x axis labelled 0..points-1, thinned to fit)
+    int16_t unitScale;   // Fixed-point units per displayed unit
+    int16_t yMin, yMax;  // Fixed axis range in series units, unless autoRange
+    bool autoRange;      // Fit the y axis to the data (whole displayed units)
+};
+
+// Panel positions are relative to (originX, originY)
+
+// Static part: title, plot border, x labels, and y labels/zero line for fixed ranges
+void drawGraphFrames(const GraphPanel panels[], int count, int originX, int originY);
+
+// Dynamic part: every panel's series (seriesCount[i] series starting at
+// series[first]), plus y labels and zero line for auto-ranged panels
+void drawGraphs(const GraphPanel panels[], int count, int originX, int originY,
+                const GraphSeries series[], const uint8_t seriesCount[]);
+
+#endif // GRAPH_H
@@ -0,0 +1,79 @@
+#include "icon_images.h"
+#include "asset_store.h"
+#include "frame_codec.h"
+#include <string.h>
+
+// Least recently recorded icons are evicted first. Every icon of a frame is
+// loaded while it is recorded and read when it is rasterised, so the cache
+// must hold one frame's worth: the hourly row, the current conditions and
+// the four chrome icons.
+static_assert(ICON_CACHE_SLOTS >= MAX_HOURLY + 5, "one frame's icons must stay cached until rasterised");
+
+#define ICON_NO_ASSET 0xFFFF
+
+static uint8_t slotData[ICON_CACHE_SLOTS][ICON_GRAY4_BYTES];
+static uint16_t slotAsset[ICON_CACHE_SLOTS];
+static uint32_t slotUsed[ICON_CACHE_SLOTS];
+static uint32_t useClock = 0;
+static bool slotsReady = false;
+
+static int findSlot(uint16_t asset) {
+    if (!slotsReady) return -1;
+    for (int i = 0; i < ICON_CACHE_SLOTS; i++) {
+        if (slotAsset[i] == asset) return i;
+    }
+    return -1;
+}
+
+static int evictSlot() {
+    int oldest = 0;
+    for (int i = 0; i < ICON_CACHE_SLOTS; i++) {
+        if (slotAsset[i] == ICON_NO_ASSET) return i;
+        if (slotUsed[i] < slotUsed[oldest]) oldest = i;
+    }
+    return oldest;
+}
+
+static bool decode(const AssetView &view, IconDepth depth, uint8_t *dst) {
+    size_t rowBytes = depth == ICON_MONO1 ? WEATHER_ICON_SIZE / 8 : WEATHER_ICON_SIZE / 2;
+    size_t size = rowBytes * WEATHER_ICON_SIZE;
+    switch (view.codec) {
+        case ASSET_RAW:
+            if (view.length != size) return false;
+            memcpy(dst, view.data, size);
+            return true;
+        case ASSET_RLE_ROWS:
+            return rleDecodeFrame(view.data, view.length, dst, rowBytes, WEATHER_ICON_SIZE);
+        default:
+            return false;
+    }
+}
+
+bool loadIcon(IconImage image, IconDepth depth) {
+    if (!slotsReady) {
+        for (int i = 0; i < ICON_CACHE_SLOTS; i++) slotAsset[i] = ICON_NO_ASSET;
+        slotsReady = true;
+    }
+    if (image >= IMAGE_COUNT) image = IMAGE_UNKNOWN;
+    uint16_t asset = ICON_ASSET_ID(image, depth);
+
+    int slot = findSlot(asset);
+    if (slot < 0) {
+        AssetView view;
+        if (!openAssetStore() || !findAsset(asset, view)) return false;
+        slot = evictSlot();
+        if (!decode(view, depth, slotData[slot])) {
+            slotAsset[slot] = ICON_NO_ASSET;
+            return false;
+        }
+        slotAsset[slot] = asset;
+    }
+    slotUsed[slot] = ++useClock;
+    return true;
+}
+
+const uint8_t *iconBitmap(IconImage image, IconDepth depth) {
+    if (image >= IMAGE_COUNT) image = IMAGE_UNKNOWN;
+    int slot = findSlot(ICON_ASSET_ID(image, depth));
+    return slot < 0 ? nullptr : slotData[slot];
+}
@@ -0,0 +1,55 @@
+#ifndef ICON_IMAGES_H
+#define ICON_IMAGES_H
+
+#include <stdint.h>
+#include "constants.h"
+
+// Icons pre-dithered to the panel's native formats at build time and stored
+// compressed in the asset partition (asset_store.h; tools/gen_assets.py
+// reads the order of IconImage from this file). The display list refers to
+// icons by index; loadIcon() decodes one into a small cache when it is
+// recorded, and the rasteriser reads it from there.
+
+#define ICON_GRAY4_BYTES (WEATHER_ICON_SIZE * WEATHER_ICON_SIZE / 2)  // 4bpp, 15 = full ink, high nibble first
+#define ICON_MONO1_BYTES (WEATHER_ICON_SIZE * WEATHER_ICON_SIZE / 8)  // 1bpp, 1 = ink, MSB first
+
+enum IconImage : uint8_t {
+    IMAGE_SUNRISE,
+    IMAGE_SUNSET,
+    IMAGE_MOONRISE,
+    IMAGE_MOONSET,
+    IMAGE_TEMPERATURE,
+    IMAGE_HUMIDITY,
+    IMAGE_PRESSURE,
+    IMAGE_UNKNOWN,
+    IMAGE_01D, IMAGE_01N,   // Clear
+    IMAGE_02D, IMAGE_02N,   // Few clouds
+    IMAGE_03D, IMAGE_03N,   // Scattered clouds
+    IMAGE_04D, IMAGE_04N,   // Broken clouds
+    IMAGE_09D, IMAGE_09N,   // Showers
+    IMAGE_10D, IMAGE_10N,   // Rain
+    IMAGE_11D, IMAGE_11N,   // Thunderstorm
+    IMAGE_13D, IMAGE_13N,   // Snow
+    IMAGE_50D, IMAGE_50N,   // Mist
+    IMAGE_COUNT
+};
+
+enum IconDepth : uint8_t {
+    ICON_GRAY4,   // Floyd-Steinberg to the panel's 16 levels
+    ICON_MONO1    // Bayer-dithered black and white, for the fast waveforms
+};
+
+// Asset id of each icon: every image in both depths
+#define ICON_ASSET_ID(image, depth) ((image) * 2 + (depth))
+#define ICON_ASSET_COUNT (IMAGE_COUNT * 2)
+
+// Decode an icon into the cache unless it is there already; false if the
+// asset partition is missing or the entry is corrupt
+bool loadIcon(IconImage image, IconDepth depth);
+
+// Packed bitmap of a cached icon, ICON_GRAY4_BYTES or ICON_MONO1_BYTES long;
+// nullptr if it has not been loaded. Never decodes, so it is safe to call
+// from both rasteriser cores.
+const uint8_t *iconBitmap(IconImage image, IconDepth depth);
+
+#endif // ICON_IMAGES_H
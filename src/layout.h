@@ -0,0 +1,171 @@
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+#include <stdint.h>
+#include "constants.h"
+#include "display.h"
+
+// Compile-time description of every dashboard panel. The renderer, the chrome
+// cache, micro-wake partial updates, the frame snapshot and touch handling all
+// work from this table, so geometry lives in one place.
+
+struct Rect {
+    int16_t x, y, w, h;
+
+    constexpr bool contains(int px, int py) const {
+        return px >= x && px < x + w && py >= y && py < y + h;
+    }
+    constexpr bool overlaps(const Rect &o) const {
+        return x < o.x + o.w && o.x < x + w && y < o.y + o.h && o.y < y + h;
+    }
+    constexpr bool empty() const { return w <= 0 || h <= 0; }
+};
+
+enum PanelId : uint8_t {
+    PANEL_HEADER,
+    PANEL_CURRENT,
+    PANEL_WIND,
+    PANEL_SUN,
+    PANEL_INFO_TITLE,
+    PANEL_CLOCK,
+    PANEL_SENSORS,
+    PANEL_HOURLY,
+    PANEL_GRAPHS,
+    PANEL_CFG,
+    PANEL_COUNT,
+    PANEL_NONE = 0xFF
+};
+
+// What a panel's dynamic content is computed from
+enum DataSource : uint8_t {
+    DATA_CURRENT = 1 << 0,   // Current conditions from the weather API
+    DATA_HOURLY = 1 << 1,    // Hourly forecast
+    DATA_DAILY = 1 << 2,     // Daily forecast
+    DATA_CLOCK = 1 << 3,     // Wall clock (RTC)
+    DATA_SENSORS = 1 << 4,   // On-board temperature/humidity sensor
+    DATA_DEVICE = 1 << 5,    // Battery level, WiFi signal
+    DATA_CONFIG = 1 << 6,    // Saved settings (city name)
+    DATA_ASTRO = 1 << 7,     // Sun and moon events, computed once per day (astro.h)
+
+    DATA_FETCHED = DATA_CURRENT | DATA_HOURLY | DATA_DAILY,
+    DATA_OFFLINE = DATA_CLOCK | DATA_SENSORS | DATA_CONFIG  // Available on a radio-free wake
+};
+
+typedef void (*PanelDrawFn)(int x, int y, int dx, int dy);
+
+struct PanelLayout {
+    PanelId id;
+    Rect rect;
+    PanelDrawFn chrome;   // Static part, rendered into the cached chrome layer
+    PanelDrawFn draw;     // Dynamic part, rendered every refresh
+    uint8_t deps;         // DataSource bits the dynamic part reads
+    Rect touch;           // Touch target, empty if the panel is not touchable
+};
+
+// Rows and columns
+constexpr int16_t ROW_X = PANEL_SPACING;
+constexpr int16_t ROW_WIDTH = SCREEN_WIDTH - 2 * PANEL_SPACING;
+constexpr int16_t TOP_ROW_Y = PANEL_TITLE_HEIGHT;
+constexpr int16_t TOP_ROW_HEIGHT = 251;
+constexpr int16_t HOURLY_ROW_Y = TOP_ROW_Y + TOP_ROW_HEIGHT;
+constexpr int16_t HOURLY_ROW_HEIGHT = 122;
+constexpr int16_t HOURLY_CELL_WIDTH = 116;
+
+constexpr int16_t WIND_PANEL_X = 232;
+constexpr int16_t SUN_PANEL_X = 465;
+constexpr int16_t INFO_PANEL_X = 697;
+constexpr int16_t INFO_PANEL_WIDTH = 245;
+constexpr int16_t CLOCK_REGION_Y_OFFSET = 40;
+constexpr int16_t CLOCK_REGION_HEIGHT = 98;
+constexpr int16_t CLOCK_REGION_Y = TOP_ROW_Y + CLOCK_REGION_Y_OFFSET;
+constexpr int16_t SENSORS_Y = CLOCK_REGION_Y + CLOCK_REGION_HEIGHT;
+
+// The [CFG] label sits under the bottom border; its touch target is larger
+constexpr int16_t CFG_LABEL_Y = GRAPH_ROW_Y + GRAPH_ROW_HEIGHT + 1;
+
+constexpr Rect NO_TOUCH = { 0, 0, 0, 0 };
+
+constexpr PanelLayout LAYOUT[PANEL_COUNT] = {
+    { PANEL_HEADER, { 0, 0, SCREEN_WIDTH, HEADER_HEIGHT },
+      drawHeaderChrome, drawHeader, DATA_DEVICE | DATA_CONFIG, NO_TOUCH },
+    { PANEL_CURRENT, { ROW_X, TOP_ROW_Y, WIND_PANEL_X - ROW_X, TOP_ROW_HEIGHT },
+      drawCurrentConditionsChrome, drawCurrentConditions, DATA_CURRENT | DATA_DAILY | DATA_ASTRO | DATA_CLOCK, NO_TOUCH },
+    { PANEL_WIND, { WIND_PANEL_X, TOP_ROW_Y, SUN_PANEL_X - WIND_PANEL_X, TOP_ROW_HEIGHT },
+      drawWindInfoChrome, drawWindInfo, DATA_CURRENT, NO_TOUCH },
+    { PANEL_SUN, { SUN_PANEL_X, TOP_ROW_Y, INFO_PANEL_X - SUN_PANEL_X, TOP_ROW_HEIGHT },
+      drawSunInfoChrome, drawSunInfo, DATA_ASTRO | DATA_CLOCK, NO_TOUCH },
+    { PANEL_INFO_TITLE, { INFO_PANEL_X, TOP_ROW_Y, INFO_PANEL_WIDTH, CLOCK_REGION_Y_OFFSET },
+      drawM5PaperInfoChrome, nullptr, 0, NO_TOUCH },
+    { PANEL_CLOCK, { INFO_PANEL_X + 1, CLOCK_REGION_Y, INFO_PANEL_WIDTH - 2, CLOCK_REGION_HEIGHT },
+      nullptr, drawClockRegion, DATA_CLOCK, NO_TOUCH },
+    { PANEL_SENSORS, { INFO_PANEL_X, SENSORS_Y, INFO_PANEL_WIDTH, HOURLY_ROW_Y - SENSORS_Y },
+      drawSensorInfoChrome, drawSensorInfo, DATA_SENSORS | DATA_CURRENT, NO_TOUCH },
+    { PANEL_HOURLY, { ROW_X, HOURLY_ROW_Y, ROW_WIDTH, HOURLY_ROW_HEIGHT },
+      drawHourlyRowChrome, drawHourlyRow, DATA_HOURLY | DATA_ASTRO | DATA_CLOCK, NO_TOUCH },
+    { PANEL_GRAPHS, { ROW_X, GRAPH_ROW_Y, ROW_WIDTH, GRAPH_ROW_HEIGHT },
+      drawGraphRowChrome, drawGraphRow, DATA_HOURLY | DATA_DAILY, NO_TOUCH },
+    { PANEL_CFG, { SCREEN_WIDTH - CFG_BUTTON_TOUCH_WIDTH, CFG_LABEL_Y, CFG_BUTTON_TOUCH_WIDTH, SCREEN_HEIGHT - CFG_LABEL_Y },
+      drawConfigButtonChrome, nullptr, 0,
+      { SCREEN_WIDTH - CFG_BUTTON_TOUCH_WIDTH, SCREEN_HEIGHT - CFG_BUTTON_TOUCH_HEIGHT, CFG_BUTTON_TOUCH_WIDTH, CFG_BUTTON_TOUCH_HEIGHT } },
+};
+
+constexpr bool layoutIndexedById() {
+    for (int i = 0; i < PANEL_COUNT; i++) {
+        if (LAYOUT[i].id != i) return false;
+    }
+    return true;
+}
+
+constexpr bool layoutOnScreen() {
+    for (int i = 0; i < PANEL_COUNT; i++) {
+        const Rect &r = LAYOUT[i].rect;
+        if (r.empty() || r.x < 0 || r.y < 0 || r.x + r.w > SCREEN_WIDTH || r.y + r.h > SCREEN_HEIGHT) return false;
+    }
+    return true;
+}
+
+constexpr bool layoutHasOverlap() {
+    for (int i = 0; i < PANEL_COUNT; i++) {
+        for (int j = i + 1; j < PANEL_COUNT; j++) {
+            if (LAYOUT[i].rect.overlaps(LAYOUT[j].rect)) return true;
+        }
+    }
+    return false;
+}
+
+static_assert(layoutIndexedById(), "LAYOUT entries must be in PanelId order");
+static_assert(layoutOnScreen(), "LAYOUT panel outside the screen");
+static_assert(!layoutHasOverlap(), "LAYOUT panels overlap");
+static_assert(GRAPH_PANEL_COUNT * GRAPH_PANEL_WIDTH == ROW_WIDTH, "graph panels must fill the graph row");
+static_assert(MAX_HOURLY * HOURLY_CELL_WIDTH <= ROW_WIDTH, "hourly cells must fit the hourly row");
+
+constexpr uint16_t panelBit(PanelId id) {
+    return 1u << id;
+}
+
+constexpr uint16_t ALL_PANELS = (1u << PANEL_COUNT) - 1;
+
+// Topmost touch target under a point, or PANEL_NONE
+constexpr PanelId panelAt(int x, int y) {
+    for (int i = 0; i < PANEL_COUNT; i++) {
+        if (!LAYOUT[i].touch.empty() && LAYOUT[i].touch.contains(x, y)) return LAYOUT[i].id;
+    }
+    return PANEL_NONE;
+}
+
+// Panels whose content depends on any of the changed sources and can be
+// redrawn from what is available
+constexpr uint16_t panelsInvalidatedBy(uint8_t changed, uint8_t available = 0xFF) {
+    uint16_t mask = 0;
+    for (int i = 0; i < PANEL_COUNT; i++) {
+        uint8_t deps = LAYOUT[i].deps;
+        if ((deps & changed) && !(deps & ~available)) mask |= panelBit(LAYOUT[i].id);
+    }
+    return mask;
+}
+
+static_assert(panelAt(SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1) == PANEL_CFG, "CFG corner must be touchable");
+static_assert(panelsInvalidatedBy(DATA_CLOCK, DATA_OFFLINE) == panelBit(PANEL_CLOCK),
+              "micro-wakes are expected to redraw only the clock");
+
+#endif // LAYOUT_H
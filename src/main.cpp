@@ -16,6 +16,11 @@
 #include "weather_api.h"
 #include "config.h"
 #include "display.h"
+#include "framestore.h"
+#include "benchmark.h"
+#include "layout.h"
+#include "boot.h"
+#include "clock_sync.h"
 
 // Global objects
 Preferences preferences;
@@ -23,41 +28,117 @@ M5Canvas canvas(&M5.Display);
 WeatherData currentWeather;
 
 // Configuration state
-bool useCelsius = false;
-bool nightModeSleep = true;
-String cityName = DEFAULT_CITY;
+Config config;
 
 // Runtime state
 unsigned long lastRefreshTime = 0;
 int refreshCounter = 0;
+time_t lastFetchTime = 0;
+time_t nextFullTime = 0;
+bool frameRestored = false;
+bool dashboardShown = false;    // This wake drew the weather, not an error screen
 
-void enterDeepSleep(unsigned long sleepTimeMs) {
-    Serial.printf("Entering deep sleep for %lu ms (%lu minutes)\n",
-                  sleepTimeMs, sleepTimeMs / 60000);
+// Radio-on time for the wake log; radioOnAt is 0 while the radio is off
+unsigned long radioOnAt = 0;
+unsigned long radioOnMs = 0;
 
+void radioOff() {
+    if (radioOnAt == 0) return;
     WiFi.disconnect(true);
     WiFi.mode(WIFI_OFF);
+    radioOnMs = millis() - radioOnAt;
+    radioOnAt = 0;
+    Serial.printf("Radio off after %lu ms\n", radioOnMs);
+}
 
+void powerOffFor(int sleepSeconds) {
     // Put IMU to sleep to reduce standby power draw
     M5.Imu.init();
     M5.Imu.sleep();
 
-    // Put display to sleep and wait for it to finish
+    // Flush serial while the EPD may still be running its waveform
+    Serial.printf("Awake %lu ms, radio on %lu ms\n", millis(), radioOnMs);
+    Serial.flush();
+
+    // Let the refresh finish, then put the display to sleep
+    M5.Display.waitDisplay();
     M5.Display.sleep();
     M5.Display.waitDisplay();
     delay(200);
 
-    // Flush serial before sleep
-    Serial.flush();
-
     // Use RTC alarm + M5.Power.powerOff() for lowest power consumption
     // This performs a more comprehensive power-down than esp_deep_sleep_start()
-    int sleepSeconds = sleepTimeMs / 1000;
     M5.Rtc.clearIRQ();
-    M5.Rtc.setAlarmIRQ(sleepSeconds);
+    M5.Rtc.setAlarmIRQ(rtcAlarmSeconds(sleepSeconds));
     M5.Power.powerOff();
 }
 
+// Seconds until the next minute-aligned micro-wake, capped at the next full refresh
+int microWakeSeconds(time_t now, time_t nextFull) {
+    int seconds = MICRO_WAKE_INTERVAL_S - (now % MICRO_WAKE_INTERVAL_S);
+    if (seconds < 5) seconds += MICRO_WAKE_INTERVAL_S;
+    if (now + seconds > nextFull) seconds = nextFull - now;
+    return seconds;
+}
+
+void enterDeepSleep(unsigned long sleepTimeMs) {
+    Serial.printf("Entering deep sleep for %lu ms (%lu minutes)\n",
+                  sleepTimeMs, sleepTimeMs / 60000);
+
+    radioOff();
+
+    int sleepSeconds = sleepTimeMs / 1000;
+    time_t now = time(nullptr);
+    if (now > MIN_VALID_EPOCH) {
+        // Remember when the next full refresh is due so micro-wakes can tell
+        // whether to just redraw the clock or fetch new weather. After an
+        // error screen there is no dashboard to put the clock on: clear it,
+        // so the next wake is a full one.
+        time_t nextFull = dashboardShown ? now + sleepSeconds : 0;
+        preferences.begin("weather", false);
+        preferences.putUInt("next_full", nextFull);
+        preferences.end();
+
+        if (dashboardShown && !isNightTime()) {
+            sleepSeconds = microWakeSeconds(now, nextFull);
+            Serial.printf("Next clock micro-wake in %d seconds\n", sleepSeconds);
+        }
+    }
+
+    powerOffFor(sleepSeconds);
+}
+
+// Returns true if this boot is an RTC alarm wake that falls before the next
+// scheduled weather refresh, so only the clock needs to be redrawn
+bool isMicroWake() {
+    if (!M5.Rtc.getIRQstatus()) return false;
+
+    time_t now = time(nullptr);
+    if (now < MIN_VALID_EPOCH) return false;
+
+    preferences.begin("weather", true);
+    nextFullTime = preferences.getUInt("next_full", 0);
+    lastFetchTime = preferences.getUInt("last_fetch", 0);
+    preferences.end();
+
+    return nextFullTime > now + MICRO_WAKE_MIN_LEAD_S;
+}
+
+// Radio-free wake: redraw the clock from the RTC and power off again
+void runMicroWake() {
+    Serial.println("*** Micro-wake: refreshing clock only ***");
+    // The driver lost the frame at power-off; without it the fast update would
+    // leave the old digits on the glass. The clock push is patched into the
+    // snapshot, so the next micro-wake starts from what is on screen.
+    restoreFrameSnapshot();
+    displayClockUpdate();
+
+    time_t now = time(nullptr);
+    int sleepSeconds = isNightTime() ? (int)(nextFullTime - now) : microWakeSeconds(now, nextFullTime);
+    Serial.printf("Sleeping %d seconds (full refresh in %ld)\n", sleepSeconds, (long)(nextFullTime - now));
+    powerOffFor(sleepSeconds);
+}
+
 void setup() {
     M5.begin();
     M5.Display.begin();
@@ -73,38 +154,44 @@ void setup() {
 
     // Reinitialize canvas after M5.Display is ready
     // This fixes the automatic wake display issue
-    canvas.setColorDepth(16);
+    canvas.setColorDepth(CANVAS_COLOR_DEPTH);
     canvas.createSprite(1, 1);  // Create minimal sprite to initialize
     canvas.deleteSprite();       // Clean up
 
     // Configure display
     M5.Display.setRotation(1);
-    M5.Display.startWrite();
-    M5.Display.fillScreen(TFT_WHITE);
-    M5.Display.setTextColor(TFT_BLACK);
-    M5.Display.setTextSize(2);
-    M5.Display.setCursor(20, 20);
-    M5.Display.println("PaperS3Weather " + String(VERSION));
-    M5.Display.setCursor(20, 50);
-    M5.Display.println("Initializing...");
-    M5.Display.endWrite();
-    M5.Display.display();
-
-    Serial.println("Splash screen displayed");
-    delay(2000);
-
-    setupWiFi();
-
-    // Set system time: use RTC if it has a valid date, otherwise fall back to NTP
-    setupTime();
-
-    // Load preferences and fetch weather
+
+#ifdef ENABLE_BENCHMARKS
+    runBenchmarks();
+#endif
+
+    // Settings are read once per wake
+    loadConfig();
+
+    // Clock-only wakes skip the splash screen and WiFi entirely; deciding that
+    // needs the RTC time before the radio is touched
+    bool timerWake = M5.Rtc.getIRQstatus();
+    if (timerWake) {
+        setupTime();
+        if (isMicroWake()) {
+            runMicroWake();
+        }
+    }
+
+    // WiFi associates while time, preferences, the restored frame and the
+    // static layer are set up; falls back to NTP and geocoding once it is up
+    radioOnAt = millis();
+    BootResult boot = runBoot(timerWake);
+    if (!boot.connected) {
+        startConfigPortal();
+    }
+
+    // Fetch weather
     if (WiFi.status() == WL_CONNECTED) {
-        float latitude, longitude;
-        loadPreferences(latitude, longitude, cityName);
+        float latitude = boot.latitude, longitude = boot.longitude;
 
         Serial.printf("Fetching weather for: %.4f, %.4f (%s)\n",
-                     latitude, longitude, cityName.c_str());
+                     latitude, longitude, config.city);
 
         bool fetchSuccess = false;
         for (int retry = 0; retry < HTTP_RETRY_ATTEMPTS; retry++) {
@@ -115,14 +202,31 @@ void setup() {
 
             if (fetchWeatherData(latitude, longitude)) {
                 Serial.println("Weather fetch successful!");
-                displayWeather();
-                lastRefreshTime = millis();
                 fetchSuccess = true;
                 break;
             }
         }
 
-        if (!fetchSuccess) {
+        // The forecast's Date header usually checks the clock; if it did not and
+        // the RTC may have drifted too far, ask for a single SNTP packet
+        if (clockResyncDue()) {
+            sntpResync();
+        }
+
+        // Everything from here on is local: drop the radio before rendering
+        radioOff();
+
+        if (fetchSuccess) {
+            lastFetchTime = time(nullptr);
+            displayWeather();
+            dashboardShown = true;
+            lastRefreshTime = millis();
+
+            // The EPD is running its waveform now; do the NVS write meanwhile
+            preferences.begin("weather", false);
+            preferences.putUInt("last_fetch", lastFetchTime);
+            preferences.end();
+        } else {
             Serial.println("All weather fetch attempts failed!");
             M5.Display.startWrite();
             M5.Display.fillScreen(TFT_WHITE);
@@ -132,10 +236,12 @@ void setup() {
             M5.Display.println("Will retry in 1 minute");
             M5.Display.endWrite();
             M5.Display.display();
+            invalidateFrameSnapshot();
             // Retry sooner on failure
             lastRefreshTime = millis() - REFRESH_INTERVAL_DAY_MS + 60000;
         }
     } else {
+        radioOff();
         M5.Display.startWrite();
         M5.Display.fillScreen(TFT_WHITE);
         M5.Display.setTextColor(TFT_BLACK);
@@ -143,6 +249,7 @@ void setup() {
         M5.Display.println("No WiFi - Touch to configure");
         M5.Display.endWrite();
         M5.Display.display();
+        invalidateFrameSnapshot();
         lastRefreshTime = millis();
     }
 
@@ -171,15 +278,10 @@ void loop() {
             while (millis() - startWait < waitDuration) {
                 M5.update();  // Update touch state
 
-                // Check for touch in bottom-right corner (CFG button area)
+                // Check for touch on the CFG button (bottom-right corner)
                 auto touch = M5.Touch.getDetail();
                 if (touch.wasPressed()) {
-                    int touchX = touch.x;
-                    int touchY = touch.y;
-
-                    // Check if touch is in CFG area (bottom-right corner)
-                    if (touchX > (SCREEN_WIDTH - CFG_BUTTON_TOUCH_WIDTH) &&
-                        touchY > (SCREEN_HEIGHT - CFG_BUTTON_TOUCH_HEIGHT)) {
+                    if (panelAt(touch.x, touch.y) == PANEL_CFG) {
                         Serial.println("\n*** CONFIG button pressed! ***");
                         M5.Display.startWrite();
                         M5.Display.fillScreen(TFT_WHITE);
@@ -215,11 +317,10 @@ void loop() {
 
             Serial.println("*** Wait period ended, entering sleep mode ***\n");
         } else {
-            // Automatic wake from timer - skip interaction window
+            // Automatic wake from timer - skip interaction window. The sleep
+            // bookkeeping below runs while the EPD finishes its waveform;
+            // powerOffFor() waits for the refresh before cutting power.
             Serial.println("\n*** Automatic wake from timer - skipping interaction window ***");
-            // Give e-ink display time to complete refresh before sleeping
-            Serial.println("*** Waiting 3 seconds for display to refresh ***");
-            delay(3000);
         }
 
         hasWaited = true;
@@ -227,20 +328,14 @@ void loop() {
 
     unsigned long sleepTime = getRefreshInterval();
 
-    // Get current settings for display
-    preferences.begin("weather", true);
-    int nightStart = preferences.getInt("night_start", 22);
-    int nightEnd = preferences.getInt("night_end", 5);
-    preferences.end();
-
     Serial.println("=================================");
-    Serial.printf("Night mode: %s\n", nightModeSleep ? "ENABLED" : "DISABLED");
-    if (nightModeSleep) {
-        Serial.printf("Night hours: %d:00 - %d:00\n", nightStart, nightEnd);
+    Serial.printf("Night mode: %s\n", config.nightMode ? "ENABLED" : "DISABLED");
+    if (config.nightMode) {
+        Serial.printf("Night hours: %d:00 - %d:00\n", config.nightStart, config.nightEnd);
     }
     Serial.printf("Current time is: %s\n", isNightTime() ? "NIGHT" : "DAY");
     Serial.printf("Refresh interval: %lu minutes\n", sleepTime / 60000);
-    Serial.printf("Refresh counter: %d/6\n", refreshCounter % 6);
+    Serial.printf("Refresh counter: %d/%d\n", refreshCounter, FULL_REFRESH_INTERVAL);
     Serial.println("=================================");
 
     enterDeepSleep(sleepTime);
@@ -0,0 +1,86 @@
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+// Lock-free single-producer/single-consumer byte ring over caller-provided
+// storage (capacity must be a power of two). The producer only advances head,
+// the consumer only advances tail; acquire/release ordering on the indices
+// publishes the bytes between them. Either side may run on either core.
+//
+// Plain C++ with no Arduino dependencies so it can be exercised on a host.
+
+class SpscRingBuffer {
+public:
+    SpscRingBuffer(uint8_t *storage, size_t capacity)
+        : buffer(storage), mask(capacity - 1), head(0), tail(0), closed(false), cancelled(false) {}
+
+    // Only valid while neither side is running
+    void reset() {
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+        closed.store(false, std::memory_order_relaxed);
+        cancelled.store(false, std::memory_order_relaxed);
+    }
+
+    size_t capacity() const { return mask + 1; }
+
+    size_t available() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_relaxed);
+    }
+
+    // ---- Producer side ----
+
+    // Contiguous free space starting at the write position; fill it, then commit()
+    size_t writeSpan(uint8_t **span) {
+        size_t h = head.load(std::memory_order_relaxed);
+        size_t free = capacity() - (h - tail.load(std::memory_order_acquire));
+        size_t toEnd = capacity() - (h & mask);
+        *span = buffer + (h & mask);
+        return free < toEnd ? free : toEnd;
+    }
+
+    void commit(size_t count) {
+        head.store(head.load(std::memory_order_relaxed) + count, std::memory_order_release);
+    }
+
+    // No more bytes will be written
+    void close() { closed.store(true, std::memory_order_release); }
+
+    // Set by the consumer when it no longer wants data
+    bool isCancelled() const { return cancelled.load(std::memory_order_acquire); }
+
+    // ---- Consumer side ----
+
+    // Copy up to length bytes out; returns 0 if the ring is currently empty
+    size_t read(uint8_t *dst, size_t length) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        size_t avail = head.load(std::memory_order_acquire) - t;
+        size_t count = length < avail ? length : avail;
+        size_t first = capacity() - (t & mask);
+        if (first > count) first = count;
+        for (size_t i = 0; i < first; i++) dst[i] = buffer[(t & mask) + i];
+        for (size_t i = first; i < count; i++) dst[i] = buffer[i - first];
+        tail.store(t + count, std::memory_order_release);
+        return count;
+    }
+
+    // True once the producer closed the ring and every byte has been read
+    bool drained() const {
+        return closed.load(std::memory_order_acquire) && available() == 0;
+    }
+
+    void cancel() { cancelled.store(true, std::memory_order_release); }
+
+private:
+    uint8_t *buffer;
+    size_t mask;
+    std::atomic<size_t> head;
+    std::atomic<size_t> tail;
+    std::atomic<bool> closed;
+    std::atomic<bool> cancelled;
+};
+
+#endif // RING_BUFFER_H
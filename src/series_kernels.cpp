@@ -0,0 +1,66 @@
+#include "series_kernels.h"
+#include <math.h>
+
+#if SERIES_KERNELS_DSP
+#include <dsps_mulc.h>
+#include <dsps_add.h>
+#endif
+
+void seriesMinMax(const int16_t *values, int n, int16_t &lo, int16_t &hi) {
+    int16_t smallest = values[0], largest = values[0];
+    for (int i = 1; i < n; i++) {
+        int16_t v = values[i];
+        smallest = v < smallest ? v : smallest;
+        largest = v > largest ? v : largest;
+    }
+    lo = smallest;
+    hi = largest;
+}
+
+void seriesToPixels(const int16_t *values, int n, int32_t lo, int32_t hi, int shift, int32_t scaleQ15,
+                    int32_t top, int16_t *out) {
+    // Distance below the top of the range, clamped and shifted
+    for (int i = 0; i < n; i++) {
+        int32_t v = values[i];
+        v = v < lo ? lo : v;
+        v = v > hi ? hi : v;
+        out[i] = (int16_t)((hi - v) << shift);
+    }
+#if SERIES_KERNELS_DSP
+    // (d * scaleQ15) >> 15 then + top; a zero stride repeats the offset
+    int16_t offset = (int16_t)top;
+    dsps_mulc_s16(out, out, n, (int16_t)scaleQ15, 1, 1);
+    dsps_add_s16(out, &offset, out, n, 1, 0, 1, 0);
+#else
+    for (int i = 0; i < n; i++) out[i] = (int16_t)(top + ((out[i] * scaleQ15) >> 15));
+#endif
+}
+
+void seriesMovingAverage(const int16_t *values, int n, int window, int16_t *out) {
+    int half = window / 2;
+    int32_t sum = 0;
+    int from = 0, to = 0;  // Summed range [from, to)
+    for (int i = 0; i < n; i++) {
+        int wantFrom = i - half > 0 ? i - half : 0;
+        int wantTo = i + half + 1 < n ? i + half + 1 : n;
+        while (to < wantTo) sum += values[to++];
+        while (from < wantFrom) sum -= values[from++];
+        int32_t count = to - from;
+        out[i] = (int16_t)((sum + (sum >= 0 ? count / 2 : -(count / 2))) / count);
+    }
+}
+
+void seriesDewPoint(const int16_t *tempTenths, const int16_t *humidity, int n, int16_t *out) {
+    const float b = 17.625f, c = 243.04f;
+    for (int i = 0; i < n; i++) {
+        if (humidity[i] <= 0) {
+            out[i] = INT16_MIN;
+            continue;
+        }
+        float t = tempTenths[i] / 10.0f;
+        float rh = humidity[i] < 100 ? humidity[i] : 100;
+        float gamma = logf(rh / 100.0f) + b * t / (c + t);
+        float dewTenths = 10.0f * c * gamma / (b - gamma);
+        out[i] = dewTenths <= INT16_MIN ? INT16_MIN : dewTenths >= INT16_MAX ? INT16_MAX : (int16_t)lroundf(dewTenths);
+    }
+}
@@ -0,0 +1,43 @@
+#ifndef SERIES_KERNELS_H
+#define SERIES_KERNELS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Whole-series transforms over int16 fixed-point series for the graph
+// engine. Plain C++, so the same code runs in the host benchmark
+// (bench/series_kernels_bench.cpp). On the device seriesToPixels() does its
+// multiply and offset with esp-dsp's s16 kernels, which use the S3's vector
+// unit where they have a variant for it (SERIES_KERNELS_DSP); the portable
+// loop does the same integer arithmetic, so both give identical pixels.
+
+#ifndef SERIES_KERNELS_DSP
+#if defined(ESP_PLATFORM) && __has_include(<dsps_mulc.h>) && __has_include(<dsps_add.h>)
+#define SERIES_KERNELS_DSP 1
+#else
+#define SERIES_KERNELS_DSP 0
+#endif
+#endif
+
+// Smallest and largest value; n must be at least 1
+void seriesMinMax(const int16_t *values, int n, int16_t &lo, int16_t &hi);
+
+// Screen y of every value: clamped into [lo, hi], then
+// top + ((((hi - v) << shift) * scaleQ15) >> 15), the graph engine's plotY().
+// (hi - lo) << shift must fit int16, scaleQ15 must be below 32768 and every
+// result must fit int16.
+void seriesToPixels(const int16_t *values, int n, int32_t lo, int32_t hi, int shift, int32_t scaleQ15,
+                    int32_t top, int16_t *out);
+
+// Not used by the firmware yet; kept with their benchmark for later series
+
+// Centred moving average over `window` samples (odd), shrinking at the ends;
+// rounded half away from zero. out must not alias values.
+void seriesMovingAverage(const int16_t *values, int n, int window, int16_t *out);
+
+// Dew point in tenths of a degree Celsius from temperature (tenths of a
+// degree Celsius) and relative humidity (percent), Magnus formula
+// (Alduchov & Eskridge 1996). Humidity 0 gives INT16_MIN.
+void seriesDewPoint(const int16_t *tempTenths, const int16_t *humidity, int n, int16_t *out);
+
+#endif // SERIES_KERNELS_H
@@ -0,0 +1,104 @@
+#include "tile_render.h"
+#include "canvas_backend.h"
+#include "constants.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+
+struct TileJob {
+    const DisplayList *list;
+    M5Canvas *tile;
+    int16_t originY;
+};
+
+static M5Canvas tiles[RENDER_TILE_COUNT];
+static int tileCount = 0;
+static const void *tiledBuffer = nullptr;   // Canvas buffer the tiles currently wrap
+static int tiledWidth = 0;
+static int tiledHeight = 0;
+static QueueHandle_t jobQueue = nullptr;
+static SemaphoreHandle_t jobsDone = nullptr;
+static TaskHandle_t worker = nullptr;
+
+static void runJob(const TileJob &job) {
+    rasteriseDisplayList(*job.list, *job.tile, 0, job.originY);
+    xSemaphoreGive(jobsDone);
+}
+
+static void workerTask(void *) {
+    TileJob job;
+    for (;;) {
+        if (xQueueReceive(jobQueue, &job, portMAX_DELAY) == pdTRUE) {
+            runJob(job);
+        }
+    }
+}
+
+// Started on first use and kept for the rest of the wake
+static bool startWorker() {
+    if (worker != nullptr) return true;
+
+    if (jobQueue == nullptr) jobQueue = xQueueCreate(RENDER_TILE_COUNT, sizeof(TileJob));
+    if (jobsDone == nullptr) jobsDone = xSemaphoreCreateCounting(RENDER_TILE_COUNT, 0);
+    if (jobQueue == nullptr || jobsDone == nullptr) return false;
+
+    BaseType_t otherCore = xPortGetCoreID() ^ 1;
+    if (xTaskCreatePinnedToCore(workerTask, "render", RENDER_TASK_STACK, nullptr,
+                                uxTaskPriorityGet(nullptr), &worker, otherCore) != pdPASS) {
+        worker = nullptr;
+        Serial.println("Render worker could not be started, rendering on one core");
+        return false;
+    }
+    return true;
+}
+
+bool prepareParallelRaster(M5Canvas &target) {
+#if CONFIG_FREERTOS_UNICORE
+    return false;
+#else
+    uint8_t *buffer = (uint8_t *)target.getBuffer();
+    if (buffer == nullptr || target.getColorDepth() != CANVAS_COLOR_DEPTH || !startWorker()) return false;
+
+    int width = target.width();
+    int height = target.height();
+    if (buffer == tiledBuffer && width == tiledWidth && height == tiledHeight) return true;
+
+    // setBuffer() drops the palette, so this allocates; keep it out of the frame
+    int rowBytes = (width + 1) / 2;
+    int tileRows = (height + RENDER_TILE_COUNT - 1) / RENDER_TILE_COUNT;
+    tileCount = 0;
+    for (int y = 0; y < height; y += tileRows) {
+        M5Canvas &tile = tiles[tileCount++];
+        tile.setColorDepth(CANVAS_COLOR_DEPTH);
+        tile.setBuffer(buffer + y * rowBytes, width, min(tileRows, height - y), CANVAS_COLOR_DEPTH);
+        tile.createPalette();
+    }
+    tiledBuffer = buffer;
+    tiledWidth = width;
+    tiledHeight = height;
+    return true;
+#endif
+}
+
+void rasteriseDisplayListParallel(const DisplayList &list, M5Canvas &target) {
+    if (!prepareParallelRaster(target)) {
+        rasteriseDisplayList(list, target);
+        return;
+    }
+
+    int tileRows = tiles[0].height();
+    for (int i = 0; i < tileCount; i++) {
+        TileJob job = { &list, &tiles[i], (int16_t)(i * tileRows) };
+        xQueueSend(jobQueue, &job, 0);
+    }
+
+    // Work through the queue alongside the other core, then wait for its last tile
+    TileJob job;
+    while (xQueueReceive(jobQueue, &job, 0) == pdTRUE) {
+        runJob(job);
+    }
+    for (int i = 0; i < tileCount; i++) {
+        xSemaphoreTake(jobsDone, portMAX_DELAY);
+    }
+}
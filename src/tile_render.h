@@ -0,0 +1,19 @@
+#ifndef TILE_RENDER_H
+#define TILE_RENDER_H
+
+#include <M5Unified.h>
+#include "displaylist.h"
+
+// Rasterise a display list into a full-screen canvas on both cores. The canvas
+// is split into horizontal tiles, each wrapped in its own sprite (own clip and
+// text state) over a slice of the same buffer; a worker pinned to the other
+// core and the calling task pull tiles from a shared queue. Output is
+// identical to rasteriseDisplayList(list, target).
+void rasteriseDisplayListParallel(const DisplayList &list, M5Canvas &target);
+
+// Wrap the tiles around the canvas and start the worker ahead of time, so
+// later calls for the same canvas do not allocate. Done on first use otherwise;
+// false if rendering will fall back to one core.
+bool prepareParallelRaster(M5Canvas &target);
+
+#endif // TILE_RENDER_H
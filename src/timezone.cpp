@@ -0,0 +1,184 @@
+#include "timezone.h"
+#include "constants.h"
+#include "config.h"
+#include "utils.h"
+#include <Arduino.h>
+#include <string.h>
+
+struct ZoneRule {
+    const char *iana;
+    const char *posix;
+};
+
+// Common zones, sorted by name for the binary search. Rules as in the tz
+// database's POSIX footers.
+static constexpr ZoneRule ZONES[] = {
+    { "Africa/Cairo",                   "EET-2EEST,M4.5.5/0,M10.5.4/24" },
+    { "Africa/Casablanca",              "<+01>-1" },
+    { "Africa/Johannesburg",            "SAST-2" },
+    { "Africa/Lagos",                   "WAT-1" },
+    { "Africa/Nairobi",                 "EAT-3" },
+    { "America/Anchorage",              "AKST9AKDT,M3.2.0,M11.1.0" },
+    { "America/Argentina/Buenos_Aires", "<-03>3" },
+    { "America/Bogota",                 "<-05>5" },
+    { "America/Caracas",                "<-04>4" },
+    { "America/Chicago",                "CST6CDT,M3.2.0,M11.1.0" },
+    { "America/Denver",                 "MST7MDT,M3.2.0,M11.1.0" },
+    { "America/Detroit",                "EST5EDT,M3.2.0,M11.1.0" },
+    { "America/Edmonton",               "MST7MDT,M3.2.0,M11.1.0" },
+    { "America/Halifax",                "AST4ADT,M3.2.0,M11.1.0" },
+    { "America/Lima",                   "<-05>5" },
+    { "America/Los_Angeles",            "PST8PDT,M3.2.0,M11.1.0" },
+    { "America/Mexico_City",            "CST6" },
+    { "America/New_York",               "EST5EDT,M3.2.0,M11.1.0" },
+    { "America/Phoenix",                "MST7" },
+    { "America/Regina",                 "CST6" },
+    { "America/Santiago",               "<-04>4<-03>,M9.1.6/24,M4.1.6/24" },
+    { "America/Sao_Paulo",              "<-03>3" },
+    { "America/St_Johns",               "NST3:30NDT,M3.2.0,M11.1.0" },
+    { "America/Toronto",                "EST5EDT,M3.2.0,M11.1.0" },
+    { "America/Vancouver",              "PST8PDT,M3.2.0,M11.1.0" },
+    { "America/Winnipeg",               "CST6CDT,M3.2.0,M11.1.0" },
+    { "Asia/Bangkok",                   "<+07>-7" },
+    { "Asia/Dhaka",                     "<+06>-6" },
+    { "Asia/Dubai",                     "<+04>-4" },
+    { "Asia/Ho_Chi_Minh",               "<+07>-7" },
+    { "Asia/Hong_Kong",                 "HKT-8" },
+    { "Asia/Jakarta",                   "WIB-7" },
+    { "Asia/Jerusalem",                 "IST-2IDT,M3.4.4/26,M10.5.0" },
+    { "Asia/Karachi",                   "PKT-5" },
+    { "Asia/Kathmandu",                 "<+0545>-5:45" },
+    { "Asia/Kolkata",                   "IST-5:30" },
+    { "Asia/Kuala_Lumpur",              "<+08>-8" },
+    { "Asia/Manila",                    "PST-8" },
+    { "Asia/Riyadh",                    "<+03>-3" },
+    { "Asia/Seoul",                     "KST-9" },
+    { "Asia/Shanghai",                  "CST-8" },
+    { "Asia/Singapore",                 "<+08>-8" },
+    { "Asia/Taipei",                    "CST-8" },
+    { "Asia/Tehran",                    "<+0330>-3:30" },
+    { "Asia/Tokyo",                     "JST-9" },
+    { "Atlantic/Reykjavik",             "GMT0" },
+    { "Australia/Adelaide",             "ACST-9:30ACDT,M10.1.0,M4.1.0/3" },
+    { "Australia/Brisbane",             "AEST-10" },
+    { "Australia/Darwin",               "ACST-9:30" },
+    { "Australia/Hobart",               "AEST-10AEDT,M10.1.0,M4.1.0/3" },
+    { "Australia/Melbourne",            "AEST-10AEDT,M10.1.0,M4.1.0/3" },
+    { "Australia/Perth",                "AWST-8" },
+    { "Australia/Sydney",               "AEST-10AEDT,M10.1.0,M4.1.0/3" },
+    { "Europe/Amsterdam",               "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Athens",                  "EET-2EEST,M3.5.0/3,M10.5.0/4" },
+    { "Europe/Berlin",                  "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Brussels",                "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Bucharest",               "EET-2EEST,M3.5.0/3,M10.5.0/4" },
+    { "Europe/Budapest",                "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Copenhagen",              "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Dublin",                  "IST-1GMT0,M10.5.0,M3.5.0/1" },
+    { "Europe/Helsinki",                "EET-2EEST,M3.5.0/3,M10.5.0/4" },
+    { "Europe/Istanbul",                "<+03>-3" },
+    { "Europe/Kyiv",                    "EET-2EEST,M3.5.0/3,M10.5.0/4" },
+    { "Europe/Lisbon",                  "WET0WEST,M3.5.0/1,M10.5.0" },
+    { "Europe/London",                  "GMT0BST,M3.5.0/1,M10.5.0" },
+    { "Europe/Madrid",                  "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Moscow",                  "MSK-3" },
+    { "Europe/Oslo",                    "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Paris",                   "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Prague",                  "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Rome",                    "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Stockholm",               "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Vienna",                  "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Warsaw",                  "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Zurich",                  "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "GMT",                            "GMT0" },
+    { "Pacific/Auckland",               "NZST-12NZDT,M9.5.0,M4.1.0/3" },
+    { "Pacific/Chatham",                "<+1245>-12:45<+1345>,M9.5.0/2:45,M4.1.0/3:45" },
+    { "Pacific/Fiji",                   "<+12>-12" },
+    { "Pacific/Honolulu",               "HST10" },
+    { "UTC",                            "UTC0" },
+};
+
+static constexpr int ZONE_COUNT = sizeof(ZONES) / sizeof(ZONES[0]);
+
+constexpr int compareNames(const char *a, const char *b) {
+    while (*a && *a == *b) {
+        a++;
+        b++;
+    }
+    return (unsigned char)*a - (unsigned char)*b;
+}
+
+constexpr bool zonesSorted() {
+    for (int i = 1; i < ZONE_COUNT; i++) {
+        if (compareNames(ZONES[i - 1].iana, ZONES[i].iana) >= 0) return false;
+    }
+    return true;
+}
+
+constexpr bool zonesFit() {
+    for (const ZoneRule &zone : ZONES) {
+        int length = 0;
+        while (zone.posix[length]) length++;
+        if (length >= TIMEZONE_RULE_SIZE) return false;
+    }
+    return true;
+}
+
+static_assert(zonesSorted(), "ZONES must be sorted by IANA name");
+static_assert(zonesFit(), "POSIX rule longer than Config::timezone");
+
+static const char *findZone(const char *iana) {
+    int low = 0, high = ZONE_COUNT - 1;
+    while (low <= high) {
+        int mid = (low + high) / 2;
+        int order = strcmp(iana, ZONES[mid].iana);
+        if (order == 0) return ZONES[mid].posix;
+        if (order < 0) {
+            high = mid - 1;
+        } else {
+            low = mid + 1;
+        }
+    }
+    return nullptr;
+}
+
+void posixTimeZone(char *rule, size_t size, const char *iana, int32_t utcOffsetSeconds) {
+    const char *known = iana ? findZone(iana) : nullptr;
+    if (known) {
+        strlcpy(rule, known, size);
+        return;
+    }
+
+    // "<+0530>-5:30": POSIX offsets count west of UTC, so the sign flips
+    int32_t minutes = utcOffsetSeconds / 60;
+    char sign = minutes < 0 ? '-' : '+';
+    int32_t magnitude = minutes < 0 ? -minutes : minutes;
+    int hours = magnitude / 60, rest = magnitude % 60;
+    if (rest) {
+        snprintf(rule, size, "<%c%02d%02d>%s%d:%02d", sign, hours, rest, minutes > 0 ? "-" : "", hours, rest);
+    } else {
+        snprintf(rule, size, "<%c%02d>%s%d", sign, hours, minutes > 0 ? "-" : "", hours);
+    }
+}
+
+void applyTimeZone() {
+    setenv("TZ", config.timezone, 1);
+    tzset();
+}
+
+bool updateTimeZone(const char *iana, int32_t utcOffsetSeconds) {
+    char rule[TIMEZONE_RULE_SIZE];
+    posixTimeZone(rule, sizeof(rule), iana, utcOffsetSeconds);
+    if (strcmp(rule, config.timezone) == 0) return false;
+
+    Serial.printf("Time zone %s: %s\n", iana ? iana : "unknown", rule);
+    strlcpy(config.timezone, rule, sizeof(config.timezone));
+    saveConfig();
+    applyTimeZone();
+    return true;
+}
+
+int utcOffsetMinutesAt(time_t utc) {
+    struct tm local;
+    localtime_r(&utc, &local);
+    return (wallSeconds(local) - utc) / 60;
+}
@@ -0,0 +1,28 @@
+#ifndef TIMEZONE_H
+#define TIMEZONE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <time.h>
+
+// Local time for the forecast location. The RTC and the system clock run on
+// UTC; local time comes from a POSIX TZ rule kept in the settings, learnt
+// from the zone Open-Meteo reports for the coordinates (timezone=auto).
+
+#define TIMEZONE_RULE_SIZE 64
+
+// POSIX TZ rule for an IANA zone name. Zones missing from the built-in table
+// get a fixed-offset rule, which the next forecast corrects after a DST change.
+void posixTimeZone(char *rule, size_t size, const char *iana, int32_t utcOffsetSeconds);
+
+// Make the stored rule the C library's local time
+void applyTimeZone();
+
+// Adopt the zone reported with a forecast; saves and applies the rule if it
+// changed. Returns true if it did.
+bool updateTimeZone(const char *iana, int32_t utcOffsetSeconds);
+
+// Minutes east of UTC in effect at the given instant
+int utcOffsetMinutesAt(time_t utc);
+
+#endif // TIMEZONE_H
@@ -1,14 +1,17 @@
 #include "utils.h"
 #include "constants.h"
-#include "Icons.h"
-#include <Preferences.h>
+#include "config.h"
+#include "weather_codes.h"
+#include "astro.h"
+#include "timezone.h"
+#include "clock_sync.h"
 #include <WiFi.h>
 #include <sys/time.h>
-
-extern Preferences preferences;
-extern bool nightModeSleep;
+#include <stdarg.h>
 
 void setupTime() {
+    applyTimeZone();
+
     // Check if RTC already has a valid date (year > 2023 means it was set previously)
     auto dt = M5.Rtc.getDateTime();
     if (dt.date.year > 2023) {
@@ -20,18 +23,35 @@ void setupTime() {
         tm.tm_mday = dt.date.date;
         tm.tm_mon = dt.date.month - 1;
         tm.tm_year = dt.date.year - 1900;
-        time_t t = mktime(&tm);
+        time_t t;
+        if (rtcHoldsLocalTime) {
+            // Written by older firmware at a fixed UTC+13 rather than under the
+            // zone's DST rule; store it as UTC from now on
+            t = wallSeconds(tm) - LEGACY_RTC_OFFSET_S;
+            struct tm utc;
+            gmtime_r(&t, &utc);
+            M5.Rtc.setDateTime(utc);
+            rtcHoldsLocalTime = false;
+            Serial.println("RTC converted from local time to UTC");
+        } else {
+            t = correctRtcTime(wallSeconds(tm));
+        }
         struct timeval now = { .tv_sec = t };
         settimeofday(&now, NULL);
-        Serial.printf("Time set from RTC: %04d-%02d-%02d %02d:%02d:%02d\n",
-                      dt.date.year, dt.date.month, dt.date.date,
-                      dt.time.hours, dt.time.minutes, dt.time.seconds);
+        // What the system clock was set to, after conversion or drift correction
+        struct tm set;
+        gmtime_r(&t, &set);
+        Serial.printf("Time set from RTC: %04d-%02d-%02d %02d:%02d:%02d UTC\n",
+                      set.tm_year + 1900, set.tm_mon + 1, set.tm_mday,
+                      set.tm_hour, set.tm_min, set.tm_sec);
     } else if (WiFi.status() == WL_CONNECTED) {
-        // RTC not set yet - use NTP and save to RTC for future boots
-        configTime(TIMEZONE_OFFSET_HOURS * 3600, 0, NTP_SERVER_1, NTP_SERVER_2);
+        // RTC not set yet - use NTP and save to RTC (in UTC) for future boots
+        configTzTime(config.timezone, NTP_SERVER_1, NTP_SERVER_2);
         struct tm tm;
-        if (getLocalTime(&tm)) {
-            M5.Rtc.setDateTime(tm);
+        if (getLocalTime(&tm, NTP_TIMEOUT_MS)) {
+            struct timeval now;
+            gettimeofday(&now, nullptr);
+            clockSynced(now.tv_sec, now.tv_usec);
             Serial.println("Time configured via NTP and saved to RTC");
         } else {
             Serial.println("NTP time sync failed");
@@ -45,106 +65,142 @@ float convertTemp(float temp) {
     return temp;
 }
 
-String formatTemp(float temp) {
-    return String((int)temp) + (useCelsius ? "C" : "F");
+const char *formatTemp(char *buf, size_t size, float temp) {
+    snprintf(buf, size, "%d%c", (int)temp, config.useCelsius ? 'C' : 'F');
+    return buf;
 }
 
-const uint8_t* getWeatherIcon(int weatherCode, bool isDaytime) {
-    if (weatherCode == 0) {
-        return isDaytime ? image_data_01d : image_data_01n;
-    }
-    if (weatherCode <= 3) {
-        return isDaytime ? image_data_02d : image_data_02n;
-    }
-    if (weatherCode >= 45 && weatherCode <= 48) {
-        return isDaytime ? image_data_50d : image_data_50n;
-    }
-    if (weatherCode >= 51 && weatherCode <= 67) {
-        return isDaytime ? image_data_10d : image_data_10n;
-    }
-    if (weatherCode >= 71 && weatherCode <= 86) {
-        return isDaytime ? image_data_13d : image_data_13n;
-    }
-    if (weatherCode >= 95) {
-        return isDaytime ? image_data_11d : image_data_11n;
-    }
-    return image_data_unknown;
-}
-
-String getWeatherConditionText(int weatherCode) {
-    if (weatherCode == 0) return "Clear";
-    if (weatherCode == 1) return "Mainly Clear";
-    if (weatherCode == 2) return "Partly Cloudy";
-    if (weatherCode == 3) return "Overcast";
-    if (weatherCode >= 45 && weatherCode <= 48) return "Foggy";
-    if (weatherCode >= 51 && weatherCode <= 55) return "Drizzle";
-    if (weatherCode >= 56 && weatherCode <= 57) return "Freezing Drizzle";
-    if (weatherCode >= 61 && weatherCode <= 65) return "Rain";
-    if (weatherCode >= 66 && weatherCode <= 67) return "Freezing Rain";
-    if (weatherCode >= 71 && weatherCode <= 75) return "Snow";
-    if (weatherCode >= 77 && weatherCode <= 77) return "Snow Grains";
-    if (weatherCode >= 80 && weatherCode <= 82) return "Rain Showers";
-    if (weatherCode >= 85 && weatherCode <= 86) return "Snow Showers";
-    if (weatherCode >= 95 && weatherCode <= 96) return "Thunderstorm";
-    if (weatherCode >= 99) return "Thunderstorm Hail";
-    return "Unknown";
+const char *formatTenths(char *buf, size_t size, float value) {
+    // %f would go through newlib's dtoa, which allocates
+    long tenths = lroundf(value * 10);
+    unsigned long magnitude = tenths < 0 ? -tenths : tenths;
+    snprintf(buf, size, "%s%lu.%lu", tenths < 0 ? "-" : "", magnitude / 10, magnitude % 10);
+    return buf;
 }
 
-bool isDaytime(int hour) {
-    int sunriseHour = DEFAULT_SUNRISE_HOUR;
-    int sunsetHour = DEFAULT_SUNSET_HOUR;
+const char *formatPercent(char *buf, size_t size, int percent) {
+    snprintf(buf, size, "%d%%", percent);
+    return buf;
+}
 
-    if (currentWeather.sunriseTime.length() >= 2) {
-        sunriseHour = currentWeather.sunriseTime.substring(0, 2).toInt();
-    }
-    if (currentWeather.sunsetTime.length() >= 2) {
-        sunsetHour = currentWeather.sunsetTime.substring(0, 2).toInt();
+const char *formatMinutes(char *buf, size_t size, int minutes) {
+    if (minutes < 0) {
+        snprintf(buf, size, "--:--");
+    } else {
+        snprintf(buf, size, "%02d:%02d", minutes / 60, minutes % 60);
     }
-    return (hour >= sunriseHour && hour < sunsetHour);
+    return buf;
 }
 
-float getMoonPhase() {
-    struct tm timeinfo;
-    if (!getLocalTime(&timeinfo)) {
-        return 0.0;
-    }
+void logPrintf(const char *format, ...) {
+    char line[LOG_LINE_SIZE];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    Serial.print(line);
+}
+
+// Day and night images per WeatherIcon
+static const IconImage ICON_IMAGES[ICON_COUNT][2] = {
+    { IMAGE_UNKNOWN, IMAGE_UNKNOWN },
+    { IMAGE_01D, IMAGE_01N },
+    { IMAGE_02D, IMAGE_02N },
+    { IMAGE_50D, IMAGE_50N },
+    { IMAGE_10D, IMAGE_10N },
+    { IMAGE_09D, IMAGE_09N },
+    { IMAGE_13D, IMAGE_13N },
+    { IMAGE_11D, IMAGE_11N },
+};
 
-    int year = timeinfo.tm_year + 1900;
-    int month = timeinfo.tm_mon + 1;
-    int day = timeinfo.tm_mday;
+IconImage getWeatherIcon(int weatherCode, bool isDaytime) {
+    const WeatherCodeInfo &info = weatherCodeInfo(weatherCode);
+    return ICON_IMAGES[info.icon][info.dayNight && !isDaytime];
+}
+
+const char *getWeatherConditionText(int weatherCode) {
+    return CONDITION_TEXTS[config.language][weatherCodeInfo(weatherCode).text];
+}
 
-    if (month <= 2) {
-        year -= 1;
-        month += 12;
+// Days-from-civil, so no time zone gets applied
+int64_t wallSeconds(const struct tm &tm) {
+    int year = tm.tm_year + 1900 - (tm.tm_mon < 2);
+    int era = (year >= 0 ? year : year - 399) / 400;
+    int yearOfEra = year - era * 400;
+    int month = tm.tm_mon + 1;
+    int dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + tm.tm_mday - 1;
+    int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    int64_t days = (int64_t)era * 146097 + dayOfEra - 719468;
+    return days * 86400 + tm.tm_hour * 3600 + tm.tm_min * 60 + tm.tm_sec;
+}
+
+time_t forecastNow() {
+    return time(nullptr);
+}
+
+int hourlySlotAt(time_t utc) {
+    int64_t offset = (int64_t)utc - currentWeather.hourlyStart;
+    return offset >= 0 ? offset / 3600 : (offset - 3599) / 3600;
+}
+
+bool hasHourly(int slot) {
+    return slot >= 0 && slot < currentWeather.hourlyCount;
+}
+
+const int16_t *hourlyWindow(const int16_t *series, int first, int16_t *scratch) {
+    if (first >= 0 && first + HOURLY_GRAPH_HOURS <= HOURLY_SLOTS) return series + first;
+    // Slots from hourlyCount up are already zero
+    for (int i = 0; i < HOURLY_GRAPH_HOURS; i++) {
+        int slot = first + i;
+        scratch[i] = (slot >= 0 && slot < HOURLY_SLOTS) ? series[slot] : 0;
     }
+    return scratch;
+}
+
+int slotLocalHour(int slot) {
+    // Through the TZ rule, so labels follow a DST change inside the window
+    time_t start = currentWeather.hourlyStart + (time_t)slot * 3600;
+    struct tm local;
+    localtime_r(&start, &local);
+    return local.tm_hour;
+}
 
-    int a = year / 100;
-    int b = a / 4;
-    int c = 2 - a + b;
-    double e = floor(365.25 * (year + 4716));
-    double f = floor(30.6001 * (month + 1));
-    double jd = c + day + e + f - 1524.5;
+bool isDaytime(int hour) {
+    // Judged at the middle of the hour
+    return sunIsUp(astroToday(), hour * 60 + 30);
+}
 
-    double daysSinceNew = jd - JULIAN_REF_DATE;
-    double newMoons = daysSinceNew / LUNAR_CYCLE_DAYS;
-    double phase = newMoons - floor(newMoons);
+struct MoonPhaseName {
+    float below;
+    const char *name;
+};
 
-    return phase;
+static constexpr MoonPhaseName MOON_PHASE_NAMES[] = {
+    { MOON_PHASE_WAXING_CRES, "Waxing Cres" },
+    { MOON_PHASE_FIRST_QTR, "First Qtr" },
+    { MOON_PHASE_WAXING_GIB, "Waxing Gib" },
+    { MOON_PHASE_FULL, "Full" },
+    { MOON_PHASE_WANING_GIB, "Waning Gib" },
+    { MOON_PHASE_LAST_QTR, "Last Qtr" },
+};
+
+const char *getMoonPhaseName(float phase) {
+    if (phase < MOON_PHASE_NEW_MIN || phase > MOON_PHASE_NEW_MAX) return "New";
+    for (const MoonPhaseName &entry : MOON_PHASE_NAMES) {
+        if (phase < entry.below) return entry.name;
+    }
+    return "Waning Cres";
 }
 
 bool isNightTime() {
-    if (!nightModeSleep) return false;
+    if (!config.nightMode) return false;
 
     struct tm timeinfo;
     if (!getLocalTime(&timeinfo)) return false;
 
     int currentHour = timeinfo.tm_hour;
-
-    // Load night mode hours from preferences
-    preferences.begin("weather", true);
-    int nightStart = preferences.getInt("night_start", NIGHT_START_HOUR);
-    int nightEnd = preferences.getInt("night_end", NIGHT_END_HOUR);
-    preferences.end();
+    int nightStart = config.nightStart;
+    int nightEnd = config.nightEnd;
 
     if (nightStart > nightEnd) {
         return (currentHour >= nightStart || currentHour < nightEnd);
@@ -154,16 +210,10 @@ bool isNightTime() {
 }
 
 unsigned long getRefreshInterval() {
-    // Load refresh intervals from preferences
-    preferences.begin("weather", true);
-    int dayInterval = preferences.getInt("day_interval", 10);
-    int nightInterval = preferences.getInt("night_interval", 60);
-    preferences.end();
-
     if (isNightTime()) {
-        return nightInterval * 60000;  // Convert minutes to milliseconds
+        return config.nightInterval * 60000UL;  // Convert minutes to milliseconds
     } else {
-        return dayInterval * 60000;  // Convert minutes to milliseconds
+        return config.dayInterval * 60000UL;  // Convert minutes to milliseconds
     }
 }
 
@@ -200,13 +250,6 @@ String urlEncode(String str) {
     return encoded;
 }
 
-// Drawing helper to reduce code duplication
-void drawDegreeSymbol(int x, int y, int radius) {
-    for (int i = 0; i < 2; i++) {
-        canvas.drawCircle(x, y, radius - i, TFT_BLACK);
-    }
-}
-
 // RSSI quality calculation (reduces duplication)
 int getRSSIQuality(int rssi) {
     int quality = RSSI_QUALITY_MULTIPLIER * (rssi + RSSI_QUALITY_OFFSET);
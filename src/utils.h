@@ -4,57 +4,47 @@
 #include <Arduino.h>
 #include <M5Unified.h>
 #include <M5GFX.h>
+#include "weather_data.h"
+#include "icon_images.h"
 
 // External references
-extern bool useCelsius;
 extern M5Canvas canvas;
 
-// Structure to hold weather data
-struct WeatherData {
-    float temperature;
-    float apparentTemperature;
-    float humidity;
-    float windSpeed;
-    float windDir;
-    float precipitation;
-    int weatherCode;
-
-    String sunriseTime;
-    String sunsetTime;
-
-    struct {
-        float temp;
-        float precip;
-        float humidity;
-        float pressure;
-        float uvIndex;
-        int weatherCode;
-    } hourly[8];  // MAX_HOURLY
-
-    float forecastMaxTemp[7];  // MAX_FORECAST
-    float forecastMinTemp[7];
-    float forecastRain[7];
-    float forecastHumidity[7];
-    float forecastPressure[7];
-
-    float todayMinTemp;
-    float todayMaxTemp;
-};
-
 extern WeatherData currentWeather;
 
-// Temperature conversion and formatting
-float convertTemp(float tempCelsius);
-String formatTemp(float temp);
+// Forecast cursor. The system clock runs on UTC, like the hourly time axis.
+time_t forecastNow();
+int hourlySlotAt(time_t utc);                  // Slot covering that instant; may be out of range
+bool hasHourly(int slot);                      // Slot was filled by the last fetch
+// HOURLY_GRAPH_HOURS values of an hourly array from the given slot: in place,
+// or copied into scratch with zeros for hours outside the stored ones
+const int16_t *hourlyWindow(const int16_t *series, int first, int16_t *scratch);
+int slotLocalHour(int slot);                   // Local hour of day the slot starts at
 
-// Icon and weather condition helpers
-const uint8_t* getWeatherIcon(int weatherCode, bool isDaytime);
-String getWeatherConditionText(int weatherCode);
-bool isDaytime(int hour);
+// Temperature conversion
+float convertTemp(float tempCelsius);
 
-// Time and astronomical calculations
+// Fixed-buffer formatting for the render path, which must not touch the heap.
+// Each writes a NUL-terminated string into buf and returns buf.
+const char *formatTemp(char *buf, size_t size, float temp);        // "21C" / "70F"
+const char *formatTenths(char *buf, size_t size, float value);     // "12.5", integer maths only
+const char *formatPercent(char *buf, size_t size, int percent);    // "87%"
+const char *formatMinutes(char *buf, size_t size, int minutes);    // "06:42", "--:--" for ASTRO_NONE
+
+// Serial.printf() heap-allocates lines of 64 characters or more; this
+// formats into a stack buffer instead
+void logPrintf(const char *format, ...) __attribute__((format(printf, 1, 2)));
+
+// Icon and weather condition helpers, looked up in the WMO code table
+// (weather_codes.h); texts are in the configured language
+IconImage getWeatherIcon(int weatherCode, bool isDaytime);
+const char *getWeatherConditionText(int weatherCode);
+const char *getMoonPhaseName(float phase);
+bool isDaytime(int hour);   // From today's sunrise and sunset (astro.h)
+
+// Time. The RTC holds UTC; local time comes from the TZ rule (timezone.h).
 void setupTime();
-float getMoonPhase();
+int64_t wallSeconds(const struct tm &tm);   // Seconds since the epoch of a wall time, no zone applied
 bool isNightTime();
 unsigned long getRefreshInterval();
 
@@ -66,7 +56,6 @@ float readInternalHumidity();
 String urlEncode(String str);
 
 // Drawing helpers (to reduce duplication)
-void drawDegreeSymbol(int x, int y, int radius);
 int getRSSIQuality(int rssi);
 
 #endif // UTILS_H
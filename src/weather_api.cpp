@@ -1,12 +1,132 @@
 #include "weather_api.h"
 #include "constants.h"
+#include "config.h"
+#include "astro.h"
+#include "timezone.h"
+#include "clock_sync.h"
 #include <WiFi.h>
 #include <HTTPClient.h>
 #include <ArduinoJson.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "ring_buffer.h"
+#include <atomic>
 
-extern bool useCelsius;
 extern WeatherData currentWeather;
 
+// ---- Parse while downloading ----
+// A producer task on the other core copies socket bytes into an SPSC ring
+// while this task parses them, so parsing overlaps the TLS receive.
+
+static uint8_t ringStorage[JSON_RING_SIZE];
+static SpscRingBuffer ring(ringStorage, JSON_RING_SIZE);
+
+// Lives on the consumer's stack; the producer must not touch it once
+// finished is set
+struct Download {
+    WiFiClient *stream;
+    int contentLength;              // -1 if the server did not send one
+    TaskHandle_t consumer;
+    std::atomic<bool> finished{false};
+    std::atomic<size_t> received{0};
+    std::atomic<unsigned long> lastByteAt{0};
+};
+
+static void downloadTask(void *arg) {
+    Download *dl = (Download *)arg;
+    unsigned long lastData = millis();
+
+    while (!ring.isCancelled()) {
+        if (dl->contentLength >= 0 && dl->received.load(std::memory_order_relaxed) >= (size_t)dl->contentLength) break;
+
+        int pending = dl->stream->available();
+        if (pending > 0) {
+            uint8_t *span;
+            size_t space = ring.writeSpan(&span);
+            if (space == 0) {
+                vTaskDelay(1);  // Parser is behind
+                continue;
+            }
+            int count = dl->stream->read(span, min((size_t)pending, space));
+            if (count > 0) {
+                ring.commit(count);
+                dl->received.fetch_add(count, std::memory_order_relaxed);
+                lastData = millis();
+                dl->lastByteAt.store(lastData, std::memory_order_relaxed);
+                xTaskNotifyGive(dl->consumer);
+            }
+        } else if (!dl->stream->connected()) {
+            break;
+        } else if (millis() - lastData > HTTP_TIMEOUT_MS) {
+            Serial.println("Download stalled, giving up");
+            break;
+        } else {
+            vTaskDelay(1);
+        }
+    }
+
+    // Read the handle first: the consumer may return as soon as it sees finished
+    TaskHandle_t consumer = dl->consumer;
+    ring.close();
+    dl->finished.store(true, std::memory_order_release);
+    xTaskNotifyGive(consumer);
+    vTaskDelete(nullptr);
+}
+
+// ArduinoJson custom reader over the ring; blocks until bytes arrive or the
+// producer closes the ring
+class RingReader {
+public:
+    int read() {
+        uint8_t c;
+        return readBytes((char *)&c, 1) == 1 ? c : -1;
+    }
+
+    size_t readBytes(char *buffer, size_t length) {
+        size_t total = 0;
+        while (total < length) {
+            size_t count = ring.read((uint8_t *)buffer + total, length - total);
+            total += count;
+            if (count == 0) {
+                if (ring.drained()) break;
+                ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(10));
+            }
+        }
+        return total;
+    }
+};
+
+static DeserializationError parseWhileDownloading(HTTPClient &http, JsonDocument &doc) {
+    Download dl = { http.getStreamPtr(), http.getSize(), xTaskGetCurrentTaskHandle() };
+    ring.reset();
+
+    unsigned long start = millis();
+    BaseType_t otherCore = xPortGetCoreID() ^ 1;
+    if (xTaskCreatePinnedToCore(downloadTask, "download", DOWNLOAD_TASK_STACK, &dl,
+                                uxTaskPriorityGet(nullptr), nullptr, otherCore) != pdPASS) {
+        Serial.println("Download task could not be started, parsing after download");
+        return deserializeJson(doc, http.getString());
+    }
+
+    RingReader reader;
+    DeserializationError error = deserializeJson(doc, reader);
+    unsigned long parsedAt = millis();
+
+    // Stop the producer (it may still be reading after a parse error) before the socket goes away
+    ring.cancel();
+    while (!dl.finished.load(std::memory_order_acquire)) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(10));
+    }
+
+    size_t received = dl.received.load(std::memory_order_relaxed);
+    unsigned long lastByteAt = dl.lastByteAt.load(std::memory_order_relaxed);
+    if (received > 0) {
+        Serial.printf("Downloaded %u bytes in %lu ms, parse finished %ld ms after the last byte\n",
+                      (unsigned)received, lastByteAt - start, (long)(parsedAt - lastByteAt));
+    }
+    return error;
+}
+
 bool fetchWeatherData(float latitude, float longitude) {
     if (WiFi.status() != WL_CONNECTED) {
         Serial.println("WiFi not connected");
@@ -19,10 +139,10 @@ bool fetchWeatherData(float latitude, float longitude) {
     url += "&longitude=" + String(longitude, 4);
     url += "&current=temperature_2m,apparent_temperature,relative_humidity_2m,precipitation,wind_speed_10m,wind_direction_10m,weather_code";
     url += "&hourly=temperature_2m,precipitation_probability,relative_humidity_2m,pressure_msl,uv_index,weather_code";
-    url += "&daily=temperature_2m_max,temperature_2m_min,precipitation_sum,relative_humidity_2m_mean,pressure_msl_mean,sunrise,sunset";
-    url += useCelsius ? "&temperature_unit=celsius&wind_speed_unit=kmh&precipitation_unit=mm" :
+    url += "&daily=temperature_2m_max,temperature_2m_min,precipitation_sum,relative_humidity_2m_mean,pressure_msl_mean";
+    url += config.useCelsius ? "&temperature_unit=celsius&wind_speed_unit=kmh&precipitation_unit=mm" :
                         "&temperature_unit=fahrenheit&wind_speed_unit=mph&precipitation_unit=inch";
-    url += "&timezone=auto&forecast_days=7";
+    url += "&timezone=auto&timeformat=unixtime&forecast_days=7";
 
     for (int retry = 0; retry < HTTP_RETRY_ATTEMPTS; retry++) {
         if (retry > 0) {
@@ -32,51 +152,56 @@ bool fetchWeatherData(float latitude, float longitude) {
 
         http.begin(url);
         http.setTimeout(HTTP_TIMEOUT_MS);
+        http.useHTTP10(true);  // No chunked transfer encoding, so the raw stream is the JSON body
+        const char *headerKeys[] = { "Date" };
+        http.collectHeaders(headerKeys, 1);
 
         int httpCode = http.GET();
 
-        if (httpCode == HTTP_CODE_OK) {
-            String payload = http.getString();
+        // Free server time for the RTC drift estimate, read as close to its arrival as possible
+        time_t serverTime;
+        if (httpCode > 0 && parseHttpDate(http.header("Date").c_str(), serverTime)) {
+            observeServerTime(serverTime);
+        }
 
-            // Parse JSON with properly sized document
+        if (httpCode == HTTP_CODE_OK) {
+            // Parse JSON as it arrives
             JsonDocument doc;
-            DeserializationError error = deserializeJson(doc, payload);
+            DeserializationError error = parseWhileDownloading(http, doc);
 
             if (!error) {
+                // Sampled now: the radio is off by the time the header is drawn
+                currentWeather.rssi = WiFi.RSSI();
+
                 // Extract current conditions
-                currentWeather.temperature = doc["current"]["temperature_2m"];
-                currentWeather.apparentTemperature = doc["current"]["apparent_temperature"];
-                currentWeather.humidity = doc["current"]["relative_humidity_2m"];
-                currentWeather.windSpeed = doc["current"]["wind_speed_10m"];
-                currentWeather.windDir = doc["current"]["wind_direction_10m"];
-                currentWeather.precipitation = doc["current"]["precipitation"];
-                currentWeather.weatherCode = doc["current"]["weather_code"];
+                JsonObject current = doc["current"];
+                float temperature = current["temperature_2m"];
+                float apparentTemperature = current["apparent_temperature"];
+                float humidity = current["relative_humidity_2m"];
+                float windSpeed = current["wind_speed_10m"];
+                float windDir = current["wind_direction_10m"];
+                currentWeather.temperature = toFixed(temperature, TEMP_SCALE);
+                currentWeather.apparentTemperature = toFixed(apparentTemperature, TEMP_SCALE);
+                currentWeather.humidity = toFixed(humidity, 1);
+                currentWeather.windSpeed = toFixed(windSpeed, SPEED_SCALE);
+                currentWeather.windDir = toFixed(windDir, 1);
+                currentWeather.precipitation = toFixed(current["precipitation"].as<float>(), PRECIP_SCALE);
+                currentWeather.weatherCode = current["weather_code"].as<int>();
 
                 Serial.println("\n=== Current Conditions from API ===");
-                Serial.printf("Temperature: %.1f\n", currentWeather.temperature);
-                Serial.printf("Feels Like: %.1f\n", currentWeather.apparentTemperature);
-                Serial.printf("Humidity: %.0f%%\n", currentWeather.humidity);
-                Serial.printf("Wind: %.1f @ %.0f°\n", currentWeather.windSpeed, currentWeather.windDir);
+                Serial.printf("Temperature: %.1f\n", temperature);
+                Serial.printf("Feels Like: %.1f\n", apparentTemperature);
+                Serial.printf("Humidity: %.0f%%\n", humidity);
+                Serial.printf("Wind: %.1f @ %.0f°\n", windSpeed, windDir);
                 Serial.printf("Weather Code: %d\n", currentWeather.weatherCode);
 
-                // Extract sunrise/sunset
-                String sunriseStr = doc["daily"]["sunrise"][0].as<String>();
-                String sunsetStr = doc["daily"]["sunset"][0].as<String>();
-                if (sunriseStr.length() > 10) {
-                    currentWeather.sunriseTime = sunriseStr.substring(11, 16);
-                }
-                if (sunsetStr.length() > 10) {
-                    currentWeather.sunsetTime = sunsetStr.substring(11, 16);
-                }
-
-                // Get current hour for indexing
-                struct tm timeinfo;
-                if (!getLocalTime(&timeinfo)) {
-                    timeinfo.tm_hour = 0;
-                }
-                int currentHourOffset = timeinfo.tm_hour;
+                // Local time follows the zone of the forecast location
+                currentWeather.utcOffset = doc["utc_offset_seconds"].as<int32_t>();
+                updateTimeZone(doc["timezone"].as<const char *>(), currentWeather.utcOffset);
+                setAstroUtcOffset(currentWeather.utcOffset / 60);
 
                 // Extract hourly data
+                JsonArray hourlyTime = doc["hourly"]["time"];
                 JsonArray hourlyTemp = doc["hourly"]["temperature_2m"];
                 JsonArray hourlyPrecip = doc["hourly"]["precipitation_probability"];
                 JsonArray hourlyHumidity = doc["hourly"]["relative_humidity_2m"];
@@ -84,18 +209,29 @@ bool fetchWeatherData(float latitude, float longitude) {
                 JsonArray hourlyUV = doc["hourly"]["uv_index"];
                 JsonArray hourlyWeatherCode = doc["hourly"]["weather_code"];
 
-                Serial.printf("Current hour: %d, using as offset into API arrays\n", currentHourOffset);
-
-                for (int i = 0; i < MAX_HOURLY && (currentHourOffset + i) < hourlyTemp.size(); i++) {
-                    int apiIndex = currentHourOffset + i;
-                    currentWeather.hourly[i].temp = hourlyTemp[apiIndex];
-                    currentWeather.hourly[i].precip = hourlyPrecip[apiIndex];
-                    currentWeather.hourly[i].humidity = hourlyHumidity[apiIndex];
-                    currentWeather.hourly[i].pressure = hourlyPressure[apiIndex];
-                    currentWeather.hourly[i].uvIndex = (apiIndex < hourlyUV.size()) ? hourlyUV[apiIndex].as<float>() : 0.0f;
-                    currentWeather.hourly[i].weatherCode = hourlyWeatherCode[apiIndex];
-                    Serial.printf("Hour %d (API index %d) UV: %.1f\n", i, apiIndex, currentWeather.hourly[i].uvIndex);
+                // Keep HOURLY_CAPACITY hours from the one in progress; the time axis is
+                // hourly from the API's first entry (local midnight, as a UTC epoch)
+                int apiCount = min(hourlyTime.size(), hourlyTemp.size());
+                currentWeather.hourlyStart = hourlyTime[0].as<int64_t>();
+                int first = hourlySlotAt(forecastNow());
+                if (first < 0 || first >= apiCount) first = 0;
+                currentWeather.hourlyStart += (int64_t)first * 3600;
+                currentWeather.hourlyCount = min(apiCount - first, HOURLY_CAPACITY);
+
+                // Unfilled slots read as zero
+                HourlySeries &hourly = currentWeather.hourly;
+                memset(&hourly, 0, sizeof(hourly));
+                for (int i = 0; i < currentWeather.hourlyCount; i++) {
+                    int apiIndex = first + i;
+                    hourly.temp[i] = toFixed(hourlyTemp[apiIndex].as<float>(), TEMP_SCALE);
+                    hourly.precipChance[i] = toFixed(hourlyPrecip[apiIndex].as<float>(), 1);
+                    hourly.humidity[i] = toFixed(hourlyHumidity[apiIndex].as<float>(), 1);
+                    hourly.pressure[i] = toFixed(hourlyPressure[apiIndex].as<float>(), PRESSURE_SCALE);
+                    hourly.uvIndex[i] = (apiIndex < hourlyUV.size()) ? toFixed(hourlyUV[apiIndex].as<float>(), UV_SCALE) : 0;
+                    hourly.weatherCode[i] = hourlyWeatherCode[apiIndex].as<int>();
                 }
+                Serial.printf("Hourly forecast: %d hours from API index %d (%02d:00 local)\n",
+                              currentWeather.hourlyCount, first, slotLocalHour(0));
 
                 // Extract daily forecast
                 JsonArray dailyMax = doc["daily"]["temperature_2m_max"];
@@ -105,17 +241,18 @@ bool fetchWeatherData(float latitude, float longitude) {
                 JsonArray dailyPressure = doc["daily"]["pressure_msl_mean"];
 
                 if (dailyMax.size() > 0 && dailyMin.size() > 0) {
-                    currentWeather.todayMinTemp = dailyMin[0];
-                    currentWeather.todayMaxTemp = dailyMax[0];
+                    currentWeather.todayMinTemp = toFixed(dailyMin[0].as<float>(), TEMP_SCALE);
+                    currentWeather.todayMaxTemp = toFixed(dailyMax[0].as<float>(), TEMP_SCALE);
                 }
 
+                DailySeries &daily = currentWeather.daily;
                 for (int i = 0; i < MAX_FORECAST && i < dailyMax.size(); i++) {
-                    currentWeather.forecastMaxTemp[i] = dailyMax[i];
-                    currentWeather.forecastMinTemp[i] = dailyMin[i];
-                    currentWeather.forecastRain[i] = dailyRain[i];
-                    currentWeather.forecastHumidity[i] = dailyHumid[i];
+                    daily.maxTemp[i] = toFixed(dailyMax[i].as<float>(), TEMP_SCALE);
+                    daily.minTemp[i] = toFixed(dailyMin[i].as<float>(), TEMP_SCALE);
+                    daily.rain[i] = toFixed(dailyRain[i].as<float>(), PRECIP_SCALE);
+                    daily.humidity[i] = toFixed(dailyHumid[i].as<float>(), 1);
                     if (i < dailyPressure.size()) {
-                        currentWeather.forecastPressure[i] = dailyPressure[i];
+                        daily.pressure[i] = toFixed(dailyPressure[i].as<float>(), PRESSURE_SCALE);
                     }
                 }
 
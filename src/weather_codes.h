@@ -0,0 +1,155 @@
+#ifndef WEATHER_CODES_H
+#define WEATHER_CODES_H
+
+#include <stdint.h>
+
+// WMO weather interpretation codes (0-99, as returned by Open-Meteo) mapped to
+// an icon, whether that icon has a night variant, and a condition text id.
+//
+// The 100-entry table is expanded from the code ranges below at compile time,
+// so a lookup is a single index. Condition texts are interned: every code
+// refers to one of the ConditionText ids, and each language is one row of
+// CONDITION_TEXTS, selected by index rather than by branching.
+
+#define WMO_CODE_COUNT 100
+
+enum WeatherIcon : uint8_t {
+    ICON_UNKNOWN,
+    ICON_CLEAR,
+    ICON_CLOUDS,
+    ICON_FOG,
+    ICON_RAIN,
+    ICON_SHOWERS,
+    ICON_SNOW,
+    ICON_THUNDER,
+    ICON_COUNT
+};
+
+enum ConditionText : uint8_t {
+    TEXT_UNKNOWN,
+    TEXT_CLEAR,
+    TEXT_MAINLY_CLEAR,
+    TEXT_PARTLY_CLOUDY,
+    TEXT_OVERCAST,
+    TEXT_FOG,
+    TEXT_DRIZZLE,
+    TEXT_FREEZING_DRIZZLE,
+    TEXT_RAIN,
+    TEXT_FREEZING_RAIN,
+    TEXT_SNOW,
+    TEXT_SNOW_GRAINS,
+    TEXT_RAIN_SHOWERS,
+    TEXT_SNOW_SHOWERS,
+    TEXT_THUNDERSTORM,
+    TEXT_THUNDERSTORM_HAIL,
+    TEXT_COUNT
+};
+
+// Stored in Config::language, so only ever append
+enum Language : uint8_t {
+    LANG_EN,
+    LANG_ES,
+    LANG_COUNT
+};
+
+struct WeatherCodeInfo {
+    WeatherIcon icon;
+    bool dayNight;          // Icon has a separate night variant
+    ConditionText text;
+};
+
+namespace weather_codes {
+
+struct CodeRange {
+    uint8_t first;
+    uint8_t last;
+    WeatherIcon icon;
+    ConditionText text;
+};
+
+// Codes not covered here are unknown
+constexpr CodeRange CODE_RANGES[] = {
+    {  0,  0, ICON_CLEAR,   TEXT_CLEAR },
+    {  1,  1, ICON_CLOUDS,  TEXT_MAINLY_CLEAR },
+    {  2,  2, ICON_CLOUDS,  TEXT_PARTLY_CLOUDY },
+    {  3,  3, ICON_CLOUDS,  TEXT_OVERCAST },
+    { 45, 48, ICON_FOG,     TEXT_FOG },
+    { 51, 55, ICON_RAIN,    TEXT_DRIZZLE },
+    { 56, 57, ICON_RAIN,    TEXT_FREEZING_DRIZZLE },
+    { 61, 65, ICON_RAIN,    TEXT_RAIN },
+    { 66, 67, ICON_RAIN,    TEXT_FREEZING_RAIN },
+    { 71, 75, ICON_SNOW,    TEXT_SNOW },
+    { 77, 77, ICON_SNOW,    TEXT_SNOW_GRAINS },
+    { 80, 82, ICON_SHOWERS, TEXT_RAIN_SHOWERS },
+    { 85, 86, ICON_SNOW,    TEXT_SNOW_SHOWERS },
+    { 95, 96, ICON_THUNDER, TEXT_THUNDERSTORM },
+    { 97, 98, ICON_THUNDER, TEXT_UNKNOWN },
+    { 99, 99, ICON_THUNDER, TEXT_THUNDERSTORM_HAIL },
+};
+
+struct CodeTable {
+    WeatherCodeInfo entry[WMO_CODE_COUNT];
+};
+
+constexpr CodeTable makeCodeTable() {
+    CodeTable table = {};
+    for (int code = 0; code < WMO_CODE_COUNT; code++) {
+        table.entry[code] = { ICON_UNKNOWN, false, TEXT_UNKNOWN };
+    }
+    for (const CodeRange &range : CODE_RANGES) {
+        for (int code = range.first; code <= range.last; code++) {
+            table.entry[code] = { range.icon, range.icon != ICON_UNKNOWN, range.text };
+        }
+    }
+    return table;
+}
+
+constexpr CodeTable CODE_TABLE = makeCodeTable();
+
+static_assert(CODE_TABLE.entry[0].icon == ICON_CLEAR, "code 0 is clear sky");
+static_assert(CODE_TABLE.entry[81].text == TEXT_RAIN_SHOWERS, "codes 80-82 are rain showers");
+static_assert(CODE_TABLE.entry[50].icon == ICON_UNKNOWN, "gaps between ranges are unknown");
+
+constexpr WeatherCodeInfo UNKNOWN_CODE = { ICON_UNKNOWN, false, TEXT_UNKNOWN };
+
+}  // namespace weather_codes
+
+// One row per language, indexed by ConditionText. Plain ASCII: the dashboard
+// fonts have no accented glyphs.
+constexpr const char *CONDITION_TEXTS[LANG_COUNT][TEXT_COUNT] = {
+    {   // LANG_EN
+        "Unknown", "Clear", "Mainly Clear", "Partly Cloudy", "Overcast", "Foggy",
+        "Drizzle", "Freezing Drizzle", "Rain", "Freezing Rain", "Snow", "Snow Grains",
+        "Rain Showers", "Snow Showers", "Thunderstorm", "Thunderstorm Hail",
+    },
+    {   // LANG_ES
+        "Desconocido", "Despejado", "Mayormente Despejado", "Parcialmente Nublado", "Cubierto", "Niebla",
+        "Llovizna", "Llovizna Helada", "Lluvia", "Lluvia Helada", "Nieve", "Cinarra",
+        "Chubascos", "Chubascos de Nieve", "Tormenta", "Tormenta con Granizo",
+    },
+};
+
+// Portal labels, as HTML
+constexpr const char *LANGUAGE_NAMES[LANG_COUNT] = { "English", "Espa&ntilde;ol" };
+
+namespace weather_codes {
+
+constexpr bool textsComplete() {
+    for (int lang = 0; lang < LANG_COUNT; lang++) {
+        for (int text = 0; text < TEXT_COUNT; text++) {
+            if (CONDITION_TEXTS[lang][text] == nullptr) return false;
+        }
+    }
+    return true;
+}
+
+static_assert(textsComplete(), "every language needs a text for every condition");
+
+}  // namespace weather_codes
+
+constexpr const WeatherCodeInfo &weatherCodeInfo(int code) {
+    return (code >= 0 && code < WMO_CODE_COUNT) ? weather_codes::CODE_TABLE.entry[code]
+                                                : weather_codes::UNKNOWN_CODE;
+}
+
+#endif // WEATHER_CODES_H
@@ -0,0 +1,95 @@
+#ifndef WEATHER_DATA_H
+#define WEATHER_DATA_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+#include <type_traits>
+#include "constants.h"
+
+// The decoded forecast. Readings are int16 fixed point (the *_SCALE units per
+// displayed unit) in one array per quantity, so a graph plots a window of an
+// array in place. The struct is plain data with fixed-width fields: it can be
+// memcpy'd to flash or RTC memory and read back by the same firmware.
+
+#define HOURLY_SLOTS HOURLY_CAPACITY
+
+static_assert(HOURLY_GRAPH_HOURS >= 24 && HOURLY_GRAPH_HOURS <= 48, "hourly graphs span 24 to 48 hours");
+
+#define TEMP_SCALE 10               // Tenths of a degree, in the configured unit
+#define SPEED_SCALE 10              // Tenths of km/h or mph
+#define PRECIP_SCALE 100            // Hundredths of mm or inch
+#define PRESSURE_SCALE 10           // Tenths of hPa
+#define UV_SCALE 10                 // Tenths of the UV index
+// Percentages, degrees and WMO codes are whole units
+
+// Float reading to fixed point, rounded and saturated at the int16 range
+inline int16_t toFixed(float value, int scale) {
+    float scaled = value * scale;
+    if (scaled >= INT16_MAX) return INT16_MAX;
+    if (scaled <= INT16_MIN) return INT16_MIN;
+    return (int16_t)lroundf(scaled);
+}
+
+inline float fromFixed(int16_t value, int scale) {
+    return (float)value / scale;
+}
+
+// Whole displayed units, truncated toward zero like a float-to-int cast
+inline int fixedWhole(int16_t value, int scale) {
+    return value / scale;
+}
+
+// One array per hourly quantity; slot i covers hourlyStart + i hours
+struct HourlySeries {
+    int16_t temp[HOURLY_SLOTS];          // TEMP_SCALE
+    int16_t precipChance[HOURLY_SLOTS];  // Percent
+    int16_t humidity[HOURLY_SLOTS];      // Percent
+    int16_t pressure[HOURLY_SLOTS];      // PRESSURE_SCALE
+    int16_t uvIndex[HOURLY_SLOTS];       // UV_SCALE
+    uint8_t weatherCode[HOURLY_SLOTS];
+};
+
+// Day 0 is today
+struct DailySeries {
+    int16_t maxTemp[MAX_FORECAST];      // TEMP_SCALE
+    int16_t minTemp[MAX_FORECAST];
+    int16_t rain[MAX_FORECAST];         // PRECIP_SCALE
+    int16_t humidity[MAX_FORECAST];     // Percent
+    int16_t pressure[MAX_FORECAST];     // PRESSURE_SCALE
+};
+
+struct WeatherData {
+    // Header: where the hourly axis starts and what was current at the fetch
+    int64_t hourlyStart;                // UTC epoch of slot 0
+    int32_t utcOffset;                  // Seconds east of UTC at the forecast location
+    int16_t temperature;                // TEMP_SCALE
+    int16_t apparentTemperature;        // TEMP_SCALE
+    int16_t todayMinTemp;               // TEMP_SCALE
+    int16_t todayMaxTemp;               // TEMP_SCALE
+    int16_t humidity;                   // Percent
+    int16_t windSpeed;                  // SPEED_SCALE
+    int16_t windDir;                    // Degrees
+    int16_t precipitation;              // PRECIP_SCALE
+    uint8_t weatherCode;
+    uint8_t hourlyCount;                // Slots filled from the fetch
+    int8_t rssi;                        // WiFi signal when the forecast was fetched
+
+    HourlySeries hourly;
+    DailySeries daily;
+};
+
+static_assert(std::is_trivially_copyable<WeatherData>::value && std::is_standard_layout<WeatherData>::value,
+              "WeatherData must stay memcpy-able");
+static_assert(offsetof(WeatherData, temperature) == 12 && offsetof(WeatherData, hourly) == 32,
+              "WeatherData header layout changed");
+static_assert(HOURLY_SLOTS % 2 == 0, "an odd slot count pads HourlySeries");
+static_assert(sizeof(HourlySeries) == 5 * 2 * HOURLY_SLOTS + HOURLY_SLOTS,
+              "HourlySeries must have no padding");
+// 32-byte header, the series, then tail padding to the int64 alignment:
+// 680 bytes at 48 hours (776 for 24 hours when every reading was a float)
+static_assert(sizeof(WeatherData) ==
+                  ((32 + sizeof(HourlySeries) + sizeof(DailySeries) + alignof(WeatherData) - 1) & ~(alignof(WeatherData) - 1)),
+              "WeatherData size changed");
+
+#endif // WEATHER_DATA_H
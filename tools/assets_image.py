@@ -0,0 +1,52 @@
+"""
+PlatformIO post script for the "assets" flash partition (asset_store.h).
+
+Rebuilds the blob with tools/gen_assets.py into the build directory, adds
+it to the images `pio run -t upload` flashes alongside the app, and adds
+`pio run -t upload_assets`, which flashes only the asset partition.
+"""
+
+Import("env")
+
+import csv
+import os
+import subprocess
+
+PARTITION = "assets"
+
+project = env.subst("$PROJECT_DIR")
+generator = os.path.join(project, "tools", "gen_assets.py")
+blob = os.path.join(env.subst("$BUILD_DIR"), "assets.bin")
+
+
+def partition_offset(label):
+    table = os.path.join(project, env.GetProjectOption("board_build.partitions"))
+    with open(table) as f:
+        rows = csv.reader(line for line in f if line.strip() and not line.lstrip().startswith("#"))
+        for row in rows:
+            cells = [cell.strip() for cell in row]
+            if cells[0] == label:
+                return cells[3]
+    raise ValueError("no %s partition in %s" % (label, table))
+
+
+offset = partition_offset(PARTITION)
+
+# Built now rather than as a build step, so it exists when the upload
+# target collects FLASH_EXTRA_IMAGES
+os.makedirs(os.path.dirname(blob), exist_ok=True)
+subprocess.check_call([env.subst("$PYTHONEXE"), generator, "-o", blob])
+env.Append(FLASH_EXTRA_IMAGES=[(offset, blob)])
+
+port = env.subst("$UPLOAD_PORT")
+env.AddCustomTarget(
+    name="upload_assets",
+    dependencies=None,
+    actions=[
+        '"$PYTHONEXE" "%s" -o "%s"' % (generator, blob),
+        '"$PYTHONEXE" "$UPLOADER" --chip %s %s--baud $UPLOAD_SPEED write_flash %s "%s"' % (
+            env.BoardConfig().get("build.mcu", "esp32s3"), '--port "%s" ' % port if port else "", offset, blob),
+    ],
+    title="Upload assets",
+    description="Rebuild the asset blob and flash only the %s partition" % PARTITION,
+)
@@ -0,0 +1,262 @@
+#!/usr/bin/env python3
+"""
+Build the asset blob for the "assets" flash partition: the icons from
+assets/Icons.h dithered to the panel's native formats and row-RLE
+compressed, behind an index the firmware maps with esp_partition_mmap
+(asset_store.h). PlatformIO runs this on every build and flashes the blob
+with the app (tools/assets_image.py); `pio run -t upload_assets` rewrites
+only the partition.
+
+Each icon is stored twice:
+
+  4bpp  16 ink levels for the quality and text waveforms
+  1bpp  black and white for epd_fast / epd_fastest, which only settle
+        pure black and pure white; dark strokes stay solid and only the
+        light fills are dithered, so the icons do not smear into blobs
+
+Icons.h holds 64x64 RGB565 images, big-endian (high byte first). Either
+format can use ordered (Bayer 8x8) or error-diffusion (Floyd-Steinberg,
+serpentine) dithering:
+
+    python3 tools/gen_assets.py [-o assets.bin] [--gray fs|bayer] [--mono bayer|fs]
+
+Defaults: Floyd-Steinberg for 4bpp, where the error is a fraction of one
+level and spreads invisibly; Bayer for 1bpp, whose fixed pattern redraws
+identically every refresh and never leaves isolated stray pixels next to
+strokes.
+"""
+
+import argparse
+import os
+import re
+import struct
+import zlib
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+SOURCE = os.path.join(ROOT, "assets", "Icons.h")
+ENUM_HEADER = os.path.join(ROOT, "src", "icon_images.h")
+SIZE = 64
+
+# Blob layout, must match asset_store.h
+ASSET_MAGIC = 0x31545341  # "AST1"
+ASSET_FORMAT_VERSION = 1
+HEADER = struct.Struct("<IHHII")   # magic, version, count, size, crc
+ENTRY = struct.Struct("<IHBB")     # offset, length, codec, reserved
+CODEC_RAW = 0
+CODEC_RLE_ROWS = 1
+
+# frame_codec.h
+RLE_MAX_LITERAL = 128
+RLE_MIN_RUN = 3
+RLE_MAX_RUN = 130
+
+# 1bpp: ink below MONO_WHITE is dropped, ink above MONO_BLACK is solid, and
+# the range in between is dithered (0..255 ink)
+MONO_WHITE = 40
+MONO_BLACK = 168
+
+BAYER8 = [
+    [0, 32, 8, 40, 2, 34, 10, 42],
+    [48, 16, 56, 24, 50, 18, 58, 26],
+    [12, 44, 4, 36, 14, 46, 6, 38],
+    [60, 28, 52, 20, 62, 30, 54, 22],
+    [3, 35, 11, 43, 1, 33, 9, 41],
+    [51, 19, 59, 27, 49, 17, 57, 25],
+    [15, 47, 7, 39, 13, 45, 5, 37],
+    [63, 31, 55, 23, 61, 29, 53, 21],
+]
+
+
+def read_enum(path):
+    """IconImage names in declaration order, without the IMAGE_ prefix."""
+    with open(path) as f:
+        text = f.read()
+    body = re.search(r"enum IconImage[^{]*\{(.*?)\};", text, re.S).group(1)
+    body = re.sub(r"//[^\n]*", "", body)
+    names = re.findall(r"IMAGE_(\w+)", body)
+    return [n for n in names if n != "COUNT"]
+
+
+def read_icons(path):
+    with open(path) as f:
+        text = f.read()
+    icons = {}
+    for m in re.finditer(r"static const uint8_t (\w+)\[(\d+)\]\s*=\s*\{(.*?)\};", text, re.S):
+        data = [int(b, 16) for b in re.findall(r"0x[0-9a-fA-F]{2}", m.group(3))]
+        if len(data) != SIZE * SIZE * 2:
+            raise ValueError("%s: expected %d bytes, found %d" % (m.group(1), SIZE * SIZE * 2, len(data)))
+        icons[m.group(1)] = data
+    return icons
+
+
+def source_name(name, icons):
+    for candidate in (name + "64x64", "image_data_" + name.lower()):
+        if candidate in icons:
+            return candidate
+    raise KeyError("no image in Icons.h for IMAGE_" + name)
+
+
+def ink(data):
+    """Ink coverage 0..255 (255 = black) per pixel, from big-endian RGB565.
+
+    The icons are colour line art: a pixel's ink is its darkest channel, so
+    the yellow sun and blue rain print as strokes rather than near-white
+    (grays come out as their luminance). The icon is then levelled so its
+    darkest pixel is full ink, which keeps the light gray snow legible.
+    """
+    out = []
+    for i in range(0, len(data), 2):
+        pixel = data[i] << 8 | data[i + 1]
+        r, g, b = pixel >> 11, (pixel >> 5) & 0x3F, pixel & 0x1F
+        r, g, b = r << 3 | r >> 2, g << 2 | g >> 4, b << 3 | b >> 2
+        out.append(255 - min(r, g, b))
+    darkest = max(out)
+    if 0 < darkest < 255:
+        out = [(v * 255 + darkest // 2) // darkest for v in out]
+    return out
+
+
+def bayer(values, levels):
+    """Ordered dither of 0..255 values to 0..levels-1."""
+    steps = levels - 1
+    out = []
+    for i, v in enumerate(values):
+        y, x = divmod(i, SIZE)
+        threshold = (BAYER8[y % 8][x % 8] + 0.5) / 64
+        out.append(min(steps, int(v * steps / 255 + threshold)))
+    return out
+
+
+def floyd_steinberg(values, levels):
+    """Serpentine Floyd-Steinberg error diffusion of 0..255 values to 0..levels-1."""
+    steps = levels - 1
+    work = [float(v) for v in values]
+    out = [0] * len(values)
+    for y in range(SIZE):
+        forward = y % 2 == 0
+        xs = range(SIZE) if forward else range(SIZE - 1, -1, -1)
+        step = 1 if forward else -1
+        for x in xs:
+            i = y * SIZE + x
+            v = min(255.0, max(0.0, work[i]))
+            q = int(v * steps / 255 + 0.5)
+            out[i] = q
+            error = v - q * 255 / steps
+            for dx, dy, weight in ((step, 0, 7), (-step, 1, 3), (0, 1, 5), (step, 1, 1)):
+                nx, ny = x + dx, y + dy
+                if 0 <= nx < SIZE and ny < SIZE:
+                    work[ny * SIZE + nx] += error * weight / 16
+    return out
+
+
+def mono_tone(values):
+    """Stretch MONO_WHITE..MONO_BLACK to the full range before dithering to 1bpp."""
+    span = MONO_BLACK - MONO_WHITE
+    return [0 if v <= MONO_WHITE else 255 if v >= MONO_BLACK else (v - MONO_WHITE) * 255 // span for v in values]
+
+
+DITHER = {"bayer": bayer, "fs": floyd_steinberg}
+
+
+def pack4(levels):
+    return [levels[i] << 4 | levels[i + 1] for i in range(0, len(levels), 2)]
+
+
+def pack1(bits):
+    out = []
+    for i in range(0, len(bits), 8):
+        byte = 0
+        for b in bits[i:i + 8]:
+            byte = byte << 1 | b
+        out.append(byte)
+    return out
+
+
+def mean_error(values, levels, steps):
+    """Mean absolute error of a dithered image over 8x8 blocks, in 0..255 ink."""
+    total = 0
+    for by in range(0, SIZE, 8):
+        for bx in range(0, SIZE, 8):
+            block = [(by + y) * SIZE + bx + x for y in range(8) for x in range(8)]
+            want = sum(values[i] for i in block)
+            got = sum(levels[i] * 255 / steps for i in block)
+            total += abs(want - got) / 64
+    return total / (SIZE // 8) ** 2
+
+
+def rle_row(row):
+    """One row in frame_codec.h's format, byte for byte what rleEncodeRow() writes."""
+    out = bytearray()
+    literal = bytearray()
+
+    def flush():
+        for i in range(0, len(literal), RLE_MAX_LITERAL):
+            chunk = literal[i:i + RLE_MAX_LITERAL]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+        literal.clear()
+
+    i = 0
+    while i < len(row):
+        run = 1
+        while i + run < len(row) and run < RLE_MAX_RUN and row[i + run] == row[i]:
+            run += 1
+        if run >= RLE_MIN_RUN:
+            flush()
+            out.append(0x80 | (run - RLE_MIN_RUN))
+            out.append(row[i])
+        else:
+            literal.extend(row[i:i + run])
+        i += run
+    flush()
+    return bytes(out)
+
+
+def compress(data, row_bytes):
+    """RLE rows, or the raw bytes if that is not smaller."""
+    rle = b"".join(rle_row(data[i:i + row_bytes]) for i in range(0, len(data), row_bytes))
+    return (CODEC_RLE_ROWS, rle) if len(rle) < len(data) else (CODEC_RAW, bytes(data))
+
+
+def build_blob(entries):
+    """Header, index and data for a list of (codec, bytes), in asset id order."""
+    index_size = len(entries) * ENTRY.size
+    offset = HEADER.size + index_size
+    index, data = bytearray(), bytearray()
+    for codec, payload in entries:
+        index.extend(ENTRY.pack(offset + len(data), len(payload), codec, 0))
+        data.extend(payload)
+    body = bytes(index + data)
+    return HEADER.pack(ASSET_MAGIC, ASSET_FORMAT_VERSION, len(entries), len(body), zlib.crc32(body)) + body
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("-o", "--output", default="assets.bin", help="blob to write (default assets.bin)")
+    parser.add_argument("--gray", choices=DITHER, default="fs", help="4bpp dithering (default fs)")
+    parser.add_argument("--mono", choices=DITHER, default="bayer", help="1bpp dithering (default bayer)")
+    args = parser.parse_args()
+
+    names = read_enum(ENUM_HEADER)
+    icons = read_icons(SOURCE)
+
+    # Asset id = image * 2 + depth (ICON_ASSET_ID in icon_images.h)
+    entries = []
+    for name in names:
+        values = ink(icons[source_name(name, icons)])
+        gray = DITHER[args.gray](values, 16)
+        mono = DITHER[args.mono](mono_tone(values), 2)
+        entries.append(compress(pack4(gray), SIZE // 2))
+        entries.append(compress(pack1(mono), SIZE // 8))
+        print("IMAGE_%-12s 4bpp error %4.1f %5d bytes   1bpp %4d ink px %4d bytes" % (
+            name, mean_error(values, gray, 15), len(entries[-2][1]), sum(mono), len(entries[-1][1])))
+
+    blob = build_blob(entries)
+    with open(args.output, "wb") as f:
+        f.write(blob)
+    print("%d icons: %d byte blob (%s 4bpp, %s 1bpp; %d bytes as RGB565)" % (
+        len(names), len(blob), args.gray, args.mono, len(names) * SIZE * SIZE * 2))
+
+
+if __name__ == "__main__":
+    main()
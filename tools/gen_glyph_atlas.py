@@ -0,0 +1,302 @@
+#!/usr/bin/env python3
+"""
+Generate src/glyph_atlas.h: anti-aliased 4bpp glyphs for the temperature
+readouts, pre-rasterised at the exact sizes the dashboard draws them.
+
+Pure Python (no PIL/freetype): parses the TrueType outlines directly and
+rasterises them with 8x8 supersampling and the non-zero winding rule.
+
+    python3 tools/gen_glyph_atlas.py [path/to/DejaVuSans-Bold.ttf]
+"""
+
+import math
+import os
+import struct
+import sys
+
+DEFAULT_FONT = "/usr/share/fonts/truetype/dejavu/DejaVuSans-Bold.ttf"
+OUTPUT = os.path.join(os.path.dirname(__file__), "..", "src", "glyph_atlas.h")
+SUPERSAMPLE = 8
+
+DEGREE = "°"
+
+# name, digit height in pixels, characters
+FONTS = [
+    ("GLYPH_FONT_XL", 60, "0123456789-" + DEGREE),  # Main temperature
+    ("GLYPH_FONT_L", 28, "0123456789-" + DEGREE),   # Feels like
+    ("GLYPH_FONT_M", 21, "0123456789-" + DEGREE + "LH:"),  # Today low/high
+    ("GLYPH_FONT_S", 14, "0123456789-" + DEGREE + "CF"),   # Hourly cells
+]
+
+
+class TrueType:
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        num_tables = struct.unpack_from(">H", self.data, 4)[0]
+        self.tables = {}
+        for i in range(num_tables):
+            tag, _, offset, length = struct.unpack_from(">4sIII", self.data, 12 + 16 * i)
+            self.tables[tag.decode("latin-1")] = (offset, length)
+
+        head = self.tables["head"][0]
+        self.units_per_em = struct.unpack_from(">H", self.data, head + 18)[0]
+        self.loca_long = struct.unpack_from(">h", self.data, head + 50)[0] == 1
+        self.num_hmetrics = struct.unpack_from(">H", self.data, self.tables["hhea"][0] + 34)[0]
+        self.cmap = self._read_cmap()
+
+    def _read_cmap(self):
+        base = self.tables["cmap"][0]
+        count = struct.unpack_from(">H", self.data, base + 2)[0]
+        for i in range(count):
+            platform, encoding, offset = struct.unpack_from(">HHI", self.data, base + 4 + 8 * i)
+            sub = base + offset
+            if platform == 3 and encoding == 1 and struct.unpack_from(">H", self.data, sub)[0] == 4:
+                return self._read_format4(sub)
+        raise ValueError("no Unicode BMP cmap (format 4)")
+
+    def _read_format4(self, sub):
+        segs = struct.unpack_from(">H", self.data, sub + 6)[0] // 2
+        ends = struct.unpack_from(">%dH" % segs, self.data, sub + 14)
+        starts = struct.unpack_from(">%dH" % segs, self.data, sub + 16 + 2 * segs)
+        deltas = struct.unpack_from(">%dh" % segs, self.data, sub + 16 + 4 * segs)
+        range_base = sub + 16 + 6 * segs
+        offsets = struct.unpack_from(">%dH" % segs, self.data, range_base)
+        cmap = {}
+        for s in range(segs):
+            for code in range(starts[s], ends[s] + 1):
+                if code == 0xFFFF:
+                    continue
+                if offsets[s] == 0:
+                    glyph = (code + deltas[s]) & 0xFFFF
+                else:
+                    addr = range_base + 2 * s + offsets[s] + 2 * (code - starts[s])
+                    glyph = struct.unpack_from(">H", self.data, addr)[0]
+                    if glyph:
+                        glyph = (glyph + deltas[s]) & 0xFFFF
+                cmap[code] = glyph
+        return cmap
+
+    def advance(self, glyph):
+        hmtx = self.tables["hmtx"][0]
+        index = min(glyph, self.num_hmetrics - 1)
+        return struct.unpack_from(">H", self.data, hmtx + 4 * index)[0]
+
+    def _glyph_range(self, glyph):
+        loca = self.tables["loca"][0]
+        if self.loca_long:
+            start, end = struct.unpack_from(">II", self.data, loca + 4 * glyph)
+        else:
+            start, end = (2 * v for v in struct.unpack_from(">HH", self.data, loca + 2 * glyph))
+        return self.tables["glyf"][0] + start, end - start
+
+    def contours(self, glyph):
+        """Outline as a list of closed polylines in font units."""
+        offset, length = self._glyph_range(glyph)
+        if length == 0:
+            return []
+        num_contours = struct.unpack_from(">h", self.data, offset)[0]
+        if num_contours < 0:
+            raise ValueError("composite glyphs are not supported")
+
+        p = offset + 10
+        end_points = struct.unpack_from(">%dH" % num_contours, self.data, p)
+        p += 2 * num_contours
+        instruction_len = struct.unpack_from(">H", self.data, p)[0]
+        p += 2 + instruction_len
+
+        num_points = end_points[-1] + 1
+        flags = []
+        while len(flags) < num_points:
+            flag = self.data[p]
+            p += 1
+            flags.append(flag)
+            if flag & 8:
+                repeat = self.data[p]
+                p += 1
+                flags.extend([flag] * repeat)
+
+        def read_coords(short_bit, same_bit):
+            nonlocal p
+            coords, value = [], 0
+            for flag in flags:
+                if flag & short_bit:
+                    delta = self.data[p]
+                    p += 1
+                    value += delta if flag & same_bit else -delta
+                elif not flag & same_bit:
+                    value += struct.unpack_from(">h", self.data, p)[0]
+                    p += 2
+                coords.append(value)
+            return coords
+
+        xs = read_coords(2, 16)
+        ys = read_coords(4, 32)
+
+        result, start = [], 0
+        for end in end_points:
+            points = [(xs[i], ys[i], flags[i] & 1) for i in range(start, end + 1)]
+            result.append(flatten(points))
+            start = end + 1
+        return result
+
+
+def flatten(points, steps=8):
+    """Turn a quadratic TrueType contour into a closed polyline."""
+    # Insert implied on-curve midpoints between consecutive off-curve points
+    expanded = []
+    n = len(points)
+    for i in range(n):
+        cur, nxt = points[i], points[(i + 1) % n]
+        expanded.append(cur)
+        if not cur[2] and not nxt[2]:
+            expanded.append(((cur[0] + nxt[0]) / 2, (cur[1] + nxt[1]) / 2, 1))
+
+    # Rotate so the contour starts on-curve
+    first = next(i for i, pt in enumerate(expanded) if pt[2])
+    expanded = expanded[first:] + expanded[:first]
+
+    line = [expanded[0][:2]]
+    i, n = 1, len(expanded)
+    while i <= n:
+        pt = expanded[i % n]
+        if pt[2]:
+            line.append(pt[:2])
+            i += 1
+        else:
+            p0, p1, p2 = line[-1], pt[:2], expanded[(i + 1) % n][:2]
+            for s in range(1, steps + 1):
+                t = s / steps
+                a, b, c = (1 - t) ** 2, 2 * t * (1 - t), t * t
+                line.append((a * p0[0] + b * p1[0] + c * p2[0], a * p0[1] + b * p1[1] + c * p2[1]))
+            i += 2
+    return line
+
+
+def rasterise(contours, scale, x0, top, width, height):
+    """Coverage 0..15 per pixel; x0/top are the bitmap origin in scaled font space."""
+    ss = SUPERSAMPLE
+    coverage = [[0] * width for _ in range(height)]
+    edges = []
+    for line in contours:
+        for (ax, ay), (bx, by) in zip(line, line[1:] + line[:1]):
+            ax, bx = (ax * scale - x0) * ss, (bx * scale - x0) * ss
+            ay, by = (top - ay * scale) * ss, (top - by * scale) * ss
+            if ay != by:
+                edges.append((ax, ay, bx, by))
+
+    for sy in range(height * ss):
+        y = sy + 0.5
+        crossings = []
+        for ax, ay, bx, by in edges:
+            if (ay <= y < by) or (by <= y < ay):
+                x = ax + (y - ay) * (bx - ax) / (by - ay)
+                crossings.append((x, 1 if by > ay else -1))
+        crossings.sort()
+
+        row = coverage[sy // ss]
+        winding = 0
+        for k, (x, direction) in enumerate(crossings[:-1]):
+            winding += direction
+            if winding == 0:
+                continue
+            start = max(0, math.ceil(crossings[k][0] - 0.5))
+            end = min(width * ss, math.ceil(crossings[k + 1][0] - 0.5))
+            for sx in range(start, end):
+                row[sx // ss] += 1
+
+    samples = ss * ss
+    return [[min(15, (c * 15 + samples // 2) // samples) for c in row] for row in coverage]
+
+
+def build_font(ttf, name, digit_height, chars):
+    zero = ttf.cmap[ord("0")]
+    zero_top = max(y for line in ttf.contours(zero) for _, y in line)
+    scale = digit_height / zero_top
+
+    glyphs = []
+    for ch in chars:
+        glyph = ttf.cmap[ord(ch)]
+        contours = ttf.contours(glyph)
+        advance = round(ttf.advance(glyph) * scale)
+        xs = [x * scale for line in contours for x, _ in line]
+        ys = [y * scale for line in contours for _, y in line]
+        left, right = math.floor(min(xs)), math.ceil(max(xs))
+        top, bottom = math.ceil(max(ys)), math.floor(min(ys))
+        width, height = right - left, top - bottom
+        bitmap = rasterise(contours, scale, left, top, width, height)
+        glyphs.append({
+            "char": ch, "width": width, "height": height, "advance": advance,
+            "x_offset": left, "y_offset": digit_height - top, "bitmap": bitmap,
+        })
+    return {"name": name, "height": digit_height, "glyphs": glyphs}
+
+
+def pack(bitmap, width):
+    """Rows of two pixels per byte, high nibble first, rows padded to a byte."""
+    data = []
+    for row in bitmap:
+        for x in range(0, width, 2):
+            hi = row[x]
+            lo = row[x + 1] if x + 1 < width else 0
+            data.append((hi << 4) | lo)
+    return data
+
+
+def char_code(ch):
+    return 0xB0 if ch == DEGREE else ord(ch)
+
+
+def emit(fonts, font_path):
+    out = [
+        "// Generated by tools/gen_glyph_atlas.py from %s - do not edit" % os.path.basename(font_path),
+        "// 4bpp coverage (15 = full ink), two pixels per byte, high nibble first",
+        "",
+        "#ifndef GLYPH_ATLAS_H",
+        "#define GLYPH_ATLAS_H",
+        "",
+        '#include "glyphs.h"',
+        "",
+    ]
+    for font in fonts:
+        name = font["name"].lower()
+        offset, data = 0, []
+        metrics = []
+        for g in font["glyphs"]:
+            packed = pack(g["bitmap"], g["width"])
+            metrics.append("    { %d, %d, %d, %d, %d, %d, %d },  // %s" % (
+                char_code(g["char"]), offset, g["width"], g["height"], g["x_offset"],
+                g["y_offset"], g["advance"], "degree" if g["char"] == DEGREE else repr(g["char"])))
+            data.extend(packed)
+            offset += len(packed)
+
+        out.append("static const uint8_t %s_bitmaps[%d] = {" % (name, len(data)))
+        for i in range(0, len(data), 16):
+            out.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+        out.append("};")
+        out.append("")
+        out.append("static const GlyphMetrics %s_metrics[%d] = {" % (name, len(metrics)))
+        out.extend(metrics)
+        out.append("};")
+        out.append("")
+        out.append("const GlyphFont %s = { %d, %d, %s_metrics, %s_bitmaps };" % (
+            font["name"], font["height"], len(metrics), name, name))
+        out.append("")
+    out.append("#endif // GLYPH_ATLAS_H")
+    out.append("")
+    return "\n".join(out)
+
+
+def main():
+    font_path = sys.argv[1] if len(sys.argv) > 1 else DEFAULT_FONT
+    ttf = TrueType(font_path)
+    fonts = [build_font(ttf, *spec) for spec in FONTS]
+    with open(OUTPUT, "w") as f:
+        f.write(emit(fonts, font_path))
+    for font in fonts:
+        size = sum((g["width"] + 1) // 2 * g["height"] for g in font["glyphs"])
+        print("%-14s %3d px  %2d glyphs  %6d bytes" % (font["name"], font["height"], len(font["glyphs"]), size))
+
+
+if __name__ == "__main__":
+    main()